@@ -0,0 +1,395 @@
+#include <benchmark/benchmark.h>
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Dimensions/Compensated.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Expressions.hpp"
+#include "Dimensions/Parallel.hpp"
+#include "Dimensions/RuntimeDimensions.hpp"
+#include "Dimensions/ScaleTable.hpp"
+#include "Dimensions/SystemBatch.hpp"
+
+namespace {
+
+// A unit system whose base scales are known at compile time.
+template <typename Real>
+class CompileTimeSystem
+    : public Dimensions::MechanicalMassDimensions<CompileTimeSystem<Real>,
+                                                  Real> {
+ public:
+  constexpr Real LengthScale() const noexcept { return 6.371e6; }
+  constexpr Real MassScale() const noexcept { return 5.972e24; }
+  constexpr Real TimeScale() const noexcept { return 3600.0; }
+};
+
+// A unit system whose base scales are only known at runtime.
+template <typename Real>
+class RuntimeSystem
+    : public Dimensions::Dimensions<RuntimeSystem<Real>, Real> {
+ public:
+  RuntimeSystem(Real length, Real density, Real time, Real temperature)
+      : length_{length},
+        density_{density},
+        time_{time},
+        temperature_{temperature} {}
+
+  Real LengthScale() const noexcept { return length_; }
+  Real DensityScale() const noexcept { return density_; }
+  Real TimeScale() const noexcept { return time_; }
+  Real TemperatureScale() const noexcept { return temperature_; }
+
+ private:
+  Real length_;
+  Real density_;
+  Real time_;
+  Real temperature_;
+};
+
+// Builds a runtime system whose scales the optimiser cannot see.
+template <typename Real>
+RuntimeSystem<Real> MakeRuntimeSystem() {
+  auto length = static_cast<Real>(6.371e6);
+  auto density = static_cast<Real>(5.514e3);
+  auto time = static_cast<Real>(3600.0);
+  auto temperature = static_cast<Real>(273.15);
+  benchmark::DoNotOptimize(length);
+  benchmark::DoNotOptimize(density);
+  benchmark::DoNotOptimize(time);
+  benchmark::DoNotOptimize(temperature);
+  return RuntimeSystem<Real>(length, density, time, temperature);
+}
+
+// Records element and byte throughput for a pass that reads and writes each
+// element once.
+template <typename Real>
+void SetThroughput(benchmark::State& state, std::size_t size) {
+  const auto iterations = static_cast<std::int64_t>(state.iterations());
+  const auto elements = iterations * static_cast<std::int64_t>(size);
+  state.SetItemsProcessed(elements);
+  state.SetBytesProcessed(2 * elements *
+                          static_cast<std::int64_t>(sizeof(Real)));
+}
+
+//-----------------------------------------------------------------------------
+// Scalar derived-scale evaluation
+//-----------------------------------------------------------------------------
+
+template <typename Real>
+void BM_EnergyScaleCompileTime(benchmark::State& state) {
+  const auto system = CompileTimeSystem<Real>{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(system.EnergyScale());
+    benchmark::DoNotOptimize(system.BoltzmannConstant());
+  }
+}
+
+template <typename Real>
+void BM_EnergyScaleRuntime(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<Real>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(system.EnergyScale());
+    benchmark::DoNotOptimize(system.BoltzmannConstant());
+    benchmark::ClobberMemory();
+  }
+}
+
+template <typename Real>
+void BM_EnergyScaleCached(benchmark::State& state) {
+  const auto system = Dimensions::CachedDimensions(MakeRuntimeSystem<Real>());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(system.EnergyScale());
+    benchmark::DoNotOptimize(system.BoltzmannConstant());
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_EnergyScaleCompileTime, float);
+BENCHMARK_TEMPLATE(BM_EnergyScaleCompileTime, double);
+BENCHMARK_TEMPLATE(BM_EnergyScaleRuntime, float);
+BENCHMARK_TEMPLATE(BM_EnergyScaleRuntime, double);
+BENCHMARK_TEMPLATE(BM_EnergyScaleCached, float);
+BENCHMARK_TEMPLATE(BM_EnergyScaleCached, double);
+
+// Builds a runtime unit system for each member of a sweep and reads three
+// factors from it, as an ensemble driver would without a SystemBatch.
+template <typename Real>
+void BM_SweepPerSystem(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto lengths = std::vector<Real>(size, static_cast<Real>(6.371e6));
+  const auto densities = std::vector<Real>(size, static_cast<Real>(5.514e3));
+  const auto times = std::vector<Real>(size, static_cast<Real>(3600));
+  const auto temperatures = std::vector<Real>(size, static_cast<Real>(273.15));
+  auto energy = std::vector<Real>(size);
+  auto g = std::vector<Real>(size);
+  auto kB = std::vector<Real>(size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto system = Dimensions::RuntimeDimensions<Real>(
+          {.lengthScale = lengths[i],
+           .densityScale = densities[i],
+           .timeScale = times[i],
+           .temperatureScale = temperatures[i]});
+      energy[i] = system.EnergyScale();
+      g[i] = system.GravitationalConstant();
+      kB[i] = system.BoltzmannConstant();
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+
+// Evaluates the same factors with vectorised passes over a SystemBatch.
+template <typename Real>
+void BM_SweepBatch(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto batch = Dimensions::SystemBatch<Real>(
+      std::vector<Real>(size, static_cast<Real>(6.371e6)),
+      std::vector<Real>(size, static_cast<Real>(5.514e3)),
+      std::vector<Real>(size, static_cast<Real>(3600)),
+      std::vector<Real>(size, static_cast<Real>(273.15)));
+  auto energy = std::vector<Real>(size);
+  auto g = std::vector<Real>(size);
+  auto kB = std::vector<Real>(size);
+  for (auto _ : state) {
+    batch.template Scales<Dimensions::Energy>(energy);
+    batch.GravitationalConstants(g);
+    batch.BoltzmannConstants(kB);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+
+BENCHMARK_TEMPLATE(BM_SweepPerSystem, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_SweepPerSystem, double)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_SweepBatch, float)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_SweepBatch, double)->Range(1 << 10, 1 << 16);
+
+//-----------------------------------------------------------------------------
+// Batch conversion
+//-----------------------------------------------------------------------------
+
+// Field sizes, in elements, ranging from L1-resident to DRAM-resident.
+constexpr std::int64_t MinimumFieldSize = 1 << 10;
+constexpr std::int64_t MaximumFieldSize = 1 << 25;
+
+template <typename Real>
+void BM_RedimensionaliseInPlace(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<Real>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<Real>(size, static_cast<Real>(1));
+  for (auto _ : state) {
+    system.Redimensionalise(std::span<Real>(field),
+                            Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<Real>(state, size);
+}
+
+// The same conversion as BM_RedimensionaliseInPlace, with a double-word
+// factor applied by one fused multiply-add per element.
+template <typename Real>
+void BM_RedimensionaliseCompensated(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<Real>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<Real>(size, static_cast<Real>(1));
+  for (auto _ : state) {
+    Dimensions::Compensated::Redimensionalise(
+        system, field, Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<Real>(state, size);
+}
+
+template <typename Real>
+void BM_NondimensionaliseOutOfPlace(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<Real>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto in = std::vector<Real>(size, static_cast<Real>(1));
+  auto out = std::vector<Real>(size);
+  for (auto _ : state) {
+    system.Nondimensionalise(std::span<const Real>(in), std::span<Real>(out),
+                             Dimensions::QuantityKind::Velocity);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<Real>(state, size);
+}
+
+// Reads single-precision storage into a double-precision working array.
+void BM_RedimensionaliseMixedPrecision(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<double>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto in = std::vector<float>(size, 1.0f);
+  auto out = std::vector<double>(size);
+  for (auto _ : state) {
+    system.Redimensionalise(std::span<const float>(in), std::span<double>(out),
+                            Dimensions::QuantityKind::Velocity);
+    benchmark::ClobberMemory();
+  }
+  const auto elements = static_cast<std::int64_t>(state.iterations()) *
+                        static_cast<std::int64_t>(size);
+  state.SetItemsProcessed(elements);
+  state.SetBytesProcessed(elements * static_cast<std::int64_t>(
+                                         sizeof(float) + sizeof(double)));
+}
+
+#if defined(DIMENSIONS_DISPATCH)
+// Scales a field with the dispatched kernels of each supported target.
+template <typename Real>
+void BM_RedimensionaliseDispatched(benchmark::State& state) {
+  using Dimensions::Dispatch::Target;
+  const auto target = static_cast<Target>(state.range(1));
+  const auto original = Dimensions::Dispatch::ActiveTarget();
+  if (!Dimensions::Dispatch::Select(target)) {
+    state.SkipWithError("Target not supported");
+    return;
+  }
+  state.SetLabel(std::string(Dimensions::Dispatch::TargetName(target)));
+  const auto system = MakeRuntimeSystem<Real>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<Real>(size, static_cast<Real>(1));
+  for (auto _ : state) {
+    system.Redimensionalise(std::span<Real>(field),
+                            Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<Real>(state, size);
+  Dimensions::Dispatch::Select(original);
+}
+#endif
+
+template <typename Real>
+void BM_RedimensionaliseParallel(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<Real>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<Real>(size, static_cast<Real>(1));
+  for (auto _ : state) {
+    Dimensions::Redimensionalise(std::execution::par_unseq, system,
+                                 std::span<Real>(field),
+                                 Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<Real>(state, size);
+}
+
+// Forms rho * v * v / 2 in a temporary and then redimensionalises it.
+void BM_KineticEnergySeparatePasses(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<double>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto rho = std::vector<double>(size, 1.0);
+  const auto v = std::vector<double>(size, 0.5);
+  auto out = std::vector<double>(size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) out[i] = rho[i] * v[i] * v[i] / 2;
+    system.Redimensionalise(std::span<double>(out),
+                            Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+
+// Evaluates the same field as one fused expression.
+void BM_KineticEnergyFused(benchmark::State& state) {
+  using namespace Dimensions::Expressions;
+  const auto system = MakeRuntimeSystem<double>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto rho = std::vector<double>(size, 1.0);
+  const auto v = std::vector<double>(size, 0.5);
+  auto out = std::vector<double>(size);
+  for (auto _ : state) {
+    Redimensionalise(system,
+                     Field<Dimensions::Density>(rho) *
+                         Field<Dimensions::Velocity>(v) *
+                         Field<Dimensions::Velocity>(v) / 2,
+                     out);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(size));
+}
+
+// Scales a complex field element by element with std::complex arithmetic.
+void BM_ComplexElementwise(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<double>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<std::complex<double>>(size, {1.0, -1.0});
+  for (auto _ : state) {
+    const auto factor = std::complex<double>(
+        system.Scale(Dimensions::QuantityKind::Traction));
+    for (auto& z : field) z *= factor;
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<std::complex<double>>(state, size);
+}
+
+// Scales the same field as packed real and imaginary parts.
+void BM_ComplexPacked(benchmark::State& state) {
+  const auto system = MakeRuntimeSystem<double>();
+  const auto size = static_cast<std::size_t>(state.range(0));
+  auto field = std::vector<std::complex<double>>(size, {1.0, -1.0});
+  for (auto _ : state) {
+    system.Redimensionalise(std::span(field),
+                            Dimensions::QuantityKind::Traction);
+    benchmark::ClobberMemory();
+  }
+  SetThroughput<std::complex<double>>(state, size);
+}
+
+BENCHMARK_TEMPLATE(BM_RedimensionaliseInPlace, float)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK_TEMPLATE(BM_RedimensionaliseInPlace, double)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK_TEMPLATE(BM_RedimensionaliseCompensated, float)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK_TEMPLATE(BM_RedimensionaliseCompensated, double)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK_TEMPLATE(BM_NondimensionaliseOutOfPlace, float)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK_TEMPLATE(BM_NondimensionaliseOutOfPlace, double)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK(BM_RedimensionaliseMixedPrecision)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK(BM_KineticEnergySeparatePasses)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK(BM_KineticEnergyFused)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK(BM_ComplexElementwise)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+BENCHMARK(BM_ComplexPacked)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize, MaximumFieldSize);
+#if defined(DIMENSIONS_DISPATCH)
+BENCHMARK_TEMPLATE(BM_RedimensionaliseDispatched, float)
+    ->ArgsProduct({{MinimumFieldSize, MinimumFieldSize << 6}, {0, 1, 2, 3}});
+BENCHMARK_TEMPLATE(BM_RedimensionaliseDispatched, double)
+    ->ArgsProduct({{MinimumFieldSize, MinimumFieldSize << 6}, {0, 1, 2, 3}});
+#endif
+BENCHMARK_TEMPLATE(BM_RedimensionaliseParallel, float)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize << 6, MaximumFieldSize)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RedimensionaliseParallel, double)
+    ->RangeMultiplier(8)
+    ->Range(MinimumFieldSize << 6, MaximumFieldSize)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,29 @@
+# Helper functions for projects that use Dimensions.
+#
+# This file is included by DimensionsConfig.cmake for installed packages and
+# by the top-level CMakeLists.txt when Dimensions is added as a subproject.
+
+include_guard(GLOBAL)
+
+# dimensions_precompile_headers(<target> [<header>...])
+#
+# Precompiles the Dimensions headers for <target>, so that the standard
+# library and NumericConcepts headers they include are parsed once per target
+# rather than once per translation unit. With no headers listed, the core
+# header set is used. Requires CMake 3.16 or newer.
+function(dimensions_precompile_headers target)
+    if(CMAKE_VERSION VERSION_LESS 3.16)
+        message(WARNING
+            "dimensions_precompile_headers requires CMake 3.16 or newer.")
+        return()
+    endif()
+    set(headers ${ARGN})
+    if(NOT headers)
+        set(headers
+            <Dimensions/Dimensions.hpp>
+            <Dimensions/ScaleTable.hpp>
+            <Dimensions/Conversion.hpp>
+            <Dimensions/Views.hpp>)
+    endif()
+    target_precompile_headers(${target} PRIVATE ${headers})
+endfunction()
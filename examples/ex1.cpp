@@ -1,6 +1,7 @@
 #include <iostream>
 
 #include "Dimensions/Dimensions.hpp"
+#include "Dimensions/ScaleTable.hpp"
 #include "NumericConcepts/NumericConcepts.hpp"
 
 namespace NC = NumericConcepts;
@@ -11,12 +12,23 @@ template <NC::Real Real>
 class DimensionedClass : public Dimensions<DimensionedClass<Real>> {
  public:
   // Define the necessary methods.
-  constexpr auto LengthScale() const { return static_cast<Real>(6.371e6); }
-  constexpr auto DensityScale() const { return static_cast<Real>(5.514e3); }
-  constexpr auto TimeScale() const { return static_cast<Real>(3600.00); }
-  constexpr auto TemperatureScale() const { return static_cast<Real>(273.15); }
+  constexpr auto LengthScale() const noexcept {
+    return static_cast<Real>(6.371e6);
+  }
+  constexpr auto DensityScale() const noexcept {
+    return static_cast<Real>(5.514e3);
+  }
+  constexpr auto TimeScale() const noexcept {
+    return static_cast<Real>(3600.00);
+  }
+  constexpr auto TemperatureScale() const noexcept {
+    return static_cast<Real>(273.15);
+  }
 };
 
+// Check that every scaling factor is computed at compile time.
+static_assert(CompileTimeSystem<DimensionedClass<double>>);
+
 int main() {
   auto d = DimensionedClass<double>();
 
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <type_traits>
+
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Kernels.hpp"
+
+/**
+ * @file Conversion.hpp
+ * @brief Direct conversion of nondimensional values between unit systems.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A value that is nondimensional in one system is converted into
+ * another by a single fused factor, rather than by redimensionalising to SI
+ * units and then nondimensionalising again. This halves the number of
+ * roundings and of passes over memory.
+ */
+
+namespace Dimensions {
+
+/**
+ * @brief Returns the factor that converts nondimensional values of a quantity
+ * from one unit system to another.
+ *
+ * @details The result is `constexpr` whenever both systems are compile-time
+ * unit systems. The ratio is formed from the unrounded scales of both systems,
+ * so it remains finite even when the individual scales overflow `Real`.
+ *
+ * @tparam Dim The physical dimension of the quantity.
+ * @param from The unit system in which values are currently nondimensional.
+ * @param to The unit system into which values are to be converted.
+ * @return The fused conversion factor.
+ */
+template <PhysicalDimension Dim, typename From, typename To>
+constexpr auto ConversionFactor(const From& from, const To& to) noexcept {
+  using Real = std::common_type_t<decltype(from.template Scale<Dim>()),
+                                  decltype(to.template Scale<Dim>())>;
+  constexpr int L = Dim::Length, M = Dim::Mass, T = Dim::Time;
+  constexpr int Theta = Dim::Temperature;
+  return static_cast<Real>(from.template ExtendedScale<L, M, T, Theta>() /
+                           to.template ExtendedScale<L, M, T, Theta>());
+}
+
+/**
+ * @brief Returns the conversion factor for a dimension whose exponents are
+ * known only at runtime.
+ * @details The factor is identical to that of the compile-time overload for
+ * the same dimension.
+ * @param from The unit system in which values are currently nondimensional.
+ * @param to The unit system into which values are to be converted.
+ * @param exponents The exponents of length, mass, time and temperature.
+ * @return The fused conversion factor.
+ */
+template <typename From, typename To>
+constexpr auto ConversionFactor(const From& from, const To& to,
+                                const std::array<int, 4>& exponents) noexcept {
+  using Real =
+      std::common_type_t<decltype(from.template Scale<Dimensionless>()),
+                         decltype(to.template Scale<Dimensionless>())>;
+  const auto [l, m, t, theta] = exponents;
+  return static_cast<Real>(from.ExtendedScale(l, m, t, theta) /
+                           to.ExtendedScale(l, m, t, theta));
+}
+
+/**
+ * @brief Returns the conversion factor for a quantity selected at runtime.
+ * @details The factor is identical to that of the compile-time overload.
+ * @param from The unit system in which values are currently nondimensional.
+ * @param to The unit system into which values are to be converted.
+ * @param kind The physical quantity.
+ * @return The fused conversion factor.
+ */
+template <typename From, typename To>
+constexpr auto ConversionFactor(const From& from, const To& to,
+                                QuantityKind kind) noexcept {
+  return VisitDimension(kind, [&]<typename Dim>(Dim) {
+    return ConversionFactor<Dim>(from, to);
+  });
+}
+
+/**
+ * @brief Converts nondimensional values between unit systems in place.
+ * @tparam Real The numeric type of the data.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param values The data to be converted.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename From, typename To, NumericConcepts::Real Real>
+void Convert(const From& from, const To& to, std::span<Real> values,
+             QuantityKind kind) noexcept {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+  Kernels::Multiply(values,
+                    static_cast<Real>(ConversionFactor(from, to, kind)));
+}
+
+/**
+ * @brief Converts nondimensional values between unit systems in a single pass.
+ * @tparam Real The numeric type of the data.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param in The data to be converted.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename From, typename To, NumericConcepts::Real Real>
+void Convert(const From& from, const To& to, std::span<const Real> in,
+             std::span<Real> out, QuantityKind kind) noexcept {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply(in, out,
+                    static_cast<Real>(ConversionFactor(from, to, kind)));
+}
+
+/**
+ * @brief Converts nondimensional values between unit systems and between
+ * storage types in a single pass.
+ *
+ * @details The fused factor is applied in the common numeric type of the two
+ * systems, with the conversions of the data to and from that type folded
+ * into the same pass.
+ *
+ * @tparam In The storage type of the input.
+ * @tparam Out The storage type of the output.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param in The data to be converted.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename From, typename To, Kernels::StorageReal In,
+          Kernels::StorageReal Out>
+  requires(!std::is_same_v<In, Out>)
+void Convert(const From& from, const To& to, std::span<const In> in,
+             std::span<Out> out, QuantityKind kind) noexcept {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply(in, out, ConversionFactor(from, to, kind));
+}
+
+/**
+ * @brief Converts nondimensional complex or tensor values between unit
+ * systems in place, scaling their real components as a packed array.
+ * @tparam T The packed element type, such as `std::complex<double>`.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param values The data to be converted.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename From, typename To, Kernels::PackedReal T>
+void Convert(const From& from, const To& to, std::span<T> values,
+             QuantityKind kind) noexcept {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+  Kernels::Multiply(values, static_cast<Kernels::PackedScalar<T>>(
+                                ConversionFactor(from, to, kind)));
+}
+
+/**
+ * @brief Converts nondimensional complex or tensor values between unit
+ * systems in a single pass.
+ * @tparam T The packed element type.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param in The data to be converted.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename From, typename To, Kernels::PackedReal T>
+void Convert(const From& from, const To& to,
+             std::type_identity_t<std::span<const T>> in, std::span<T> out,
+             QuantityKind kind) noexcept {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply<T>(in, out, static_cast<Kernels::PackedScalar<T>>(
+                                    ConversionFactor(from, to, kind)));
+}
+
+}  // namespace Dimensions
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Portability.hpp"
+#include "Dimensions/ScaleTable.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Device.hpp
+ * @brief Batch conversion of fields held in GPU memory.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details The scale accessors of every unit system are marked
+ * `DIMENSIONS_HOST_DEVICE`, so factors can be evaluated inside kernels. For
+ * kernels that need factors selected at runtime it is usually better to pass
+ * a `ScaleTable`, which is trivially copyable, by value or through constant
+ * memory and call `TableScale` or `TableInverseScale`. This header adds
+ * launchers that rescale a device field in place without copying it to the
+ * host. The kernels are only defined when compiling with CUDA.
+ */
+
+#if defined(__CUDACC__)
+
+namespace Dimensions::Device {
+
+/**
+ * @brief Multiplies `size` elements at `data` by `factor` with a grid-stride
+ * loop.
+ */
+template <NumericConcepts::Real Real>
+__global__ void MultiplyKernel(Real* data, std::size_t size, Real factor) {
+  const auto stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+  for (auto i = static_cast<std::size_t>(blockIdx.x) * blockDim.x +
+                threadIdx.x;
+       i < size; i += stride) {
+    data[i] *= factor;
+  }
+}
+
+/**
+ * @brief Multiplies every element of a device field by the scale, or its
+ * reciprocal, read from a table on the device.
+ */
+template <NumericConcepts::Real Real>
+__global__ void ScaleKernel(Real* data, std::size_t size,
+                            ScaleTable<Real> table, QuantityKind kind,
+                            bool inverse) {
+  const auto factor = inverse ? TableInverseScale(table, kind)
+                              : TableScale(table, kind);
+  const auto stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+  for (auto i = static_cast<std::size_t>(blockIdx.x) * blockDim.x +
+                threadIdx.x;
+       i < size; i += stride) {
+    data[i] *= factor;
+  }
+}
+
+/** @brief The number of threads in each block launched by this header. */
+inline constexpr unsigned BlockSize = 256;
+
+/** @brief Returns the number of blocks used for a field of `size` elements. */
+inline unsigned GridSize(std::size_t size) noexcept {
+  constexpr std::size_t maximum = 65535;
+  const auto blocks = (size + BlockSize - 1) / BlockSize;
+  return static_cast<unsigned>(blocks < maximum ? blocks : maximum);
+}
+
+/**
+ * @brief Multiplies a field in device memory by `factor`, asynchronously on
+ * `stream`.
+ * @param values The device field.
+ * @param factor The scaling factor.
+ * @param stream The stream on which the kernel is launched.
+ */
+template <NumericConcepts::Real Real>
+void Multiply(std::span<Real> values, Real factor, cudaStream_t stream = 0) {
+  if (values.empty()) return;
+  MultiplyKernel<<<GridSize(values.size()), BlockSize, 0, stream>>>(
+      values.data(), values.size(), factor);
+}
+
+/**
+ * @brief Converts a device field to nondimensional form in place.
+ * @param table The scale table of the unit system.
+ * @param values The device field.
+ * @param kind The physical quantity that the field represents.
+ * @param stream The stream on which the kernel is launched.
+ */
+template <NumericConcepts::Real Real>
+void Nondimensionalise(const ScaleTable<Real>& table, std::span<Real> values,
+                       QuantityKind kind, cudaStream_t stream = 0) {
+  if (values.empty()) return;
+  ScaleKernel<<<GridSize(values.size()), BlockSize, 0, stream>>>(
+      values.data(), values.size(), table, kind, true);
+}
+
+/**
+ * @brief Converts a device field to dimensional form in place.
+ * @param table The scale table of the unit system.
+ * @param values The device field.
+ * @param kind The physical quantity that the field represents.
+ * @param stream The stream on which the kernel is launched.
+ */
+template <NumericConcepts::Real Real>
+void Redimensionalise(const ScaleTable<Real>& table, std::span<Real> values,
+                      QuantityKind kind, cudaStream_t stream = 0) {
+  if (values.empty()) return;
+  ScaleKernel<<<GridSize(values.size()), BlockSize, 0, stream>>>(
+      values.data(), values.size(), table, kind, false);
+}
+
+}  // namespace Dimensions::Device
+
+#endif
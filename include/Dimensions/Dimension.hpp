@@ -0,0 +1,221 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+
+#include "Dimensions/Portability.hpp"
+
+/**
+ * @file Dimension.hpp
+ * @brief Compile-time representation of physical dimensions.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ */
+
+namespace Dimensions {
+
+/**
+ * @brief The physical dimension L^L M^M T^T Θ^Theta as a type.
+ *
+ * @details The exponents refer to length, mass, time and temperature. A
+ * dimension type carries no data, and is used to select scaling factors at
+ * compile time through `Dimensions::Scale`.
+ *
+ * @tparam L The exponent of length.
+ * @tparam M The exponent of mass.
+ * @tparam T The exponent of time.
+ * @tparam Theta The exponent of temperature.
+ */
+template <int L, int M, int T, int Theta = 0>
+struct Dimension {
+  static constexpr int Length = L;
+  static constexpr int Mass = M;
+  static constexpr int Time = T;
+  static constexpr int Temperature = Theta;
+};
+
+namespace Detail {
+template <typename T>
+struct IsDimension : std::false_type {};
+
+template <int L, int M, int T, int Theta>
+struct IsDimension<Dimension<L, M, T, Theta>> : std::true_type {};
+}  // namespace Detail
+
+/**
+ * @brief Concept satisfied by specialisations of `Dimension`.
+ */
+template <typename T>
+concept PhysicalDimension = Detail::IsDimension<T>::value;
+
+/** @name Dimension Arithmetic
+ * @brief The dimensions of products, quotients and powers of quantities.
+ * @{
+ */
+template <PhysicalDimension A, PhysicalDimension B>
+using DimensionProduct =
+    Dimension<A::Length + B::Length, A::Mass + B::Mass, A::Time + B::Time,
+              A::Temperature + B::Temperature>;
+
+template <PhysicalDimension A, PhysicalDimension B>
+using DimensionQuotient =
+    Dimension<A::Length - B::Length, A::Mass - B::Mass, A::Time - B::Time,
+              A::Temperature - B::Temperature>;
+
+template <PhysicalDimension A, int N>
+using DimensionPower = Dimension<N * A::Length, N * A::Mass, N * A::Time,
+                                 N * A::Temperature>;
+
+template <PhysicalDimension A>
+using DimensionInverse = DimensionPower<A, -1>;
+/** @} */
+
+/** @name Named Dimensions
+ * @brief Dimensions of the quantities with named scales in `Dimensions`.
+ * @{
+ */
+using Dimensionless = Dimension<0, 0, 0, 0>;
+using Length = Dimension<1, 0, 0, 0>;
+using Mass = Dimension<0, 1, 0, 0>;
+using Time = Dimension<0, 0, 1, 0>;
+using Temperature = Dimension<0, 0, 0, 1>;
+using Density = Dimension<-3, 1, 0, 0>;
+using Velocity = Dimension<1, 0, -1, 0>;
+using Acceleration = Dimension<1, 0, -2, 0>;
+using Force = Dimension<1, 1, -2, 0>;
+using Traction = Dimension<-1, 1, -2, 0>;
+using Moment = Dimension<2, 1, -2, 0>;
+using Potential = Dimension<2, 0, -2, 0>;
+using Energy = Dimension<2, 1, -2, 0>;
+using HeatFlux = Dimension<0, 1, -3, 0>;
+using ThermalConductivity = Dimension<1, 1, -3, -1>;
+using SpecificHeat = Dimension<2, 0, -2, -1>;
+using Entropy = Dimension<2, 1, -2, -1>;
+/** @} */
+
+/**
+ * @brief Enumerates the physical quantities for which a unit system provides
+ * a scaling factor.
+ *
+ * @details Used to select a scale at runtime, for example when applying the
+ * batch conversion functions to a field.
+ */
+enum class QuantityKind {
+  Length,
+  Density,
+  Time,
+  Temperature,
+  Mass,
+  Velocity,
+  Acceleration,
+  Force,
+  Traction,
+  Moment,
+  Potential,
+  Energy,
+  HeatFlux,
+  ThermalConductivity,
+  SpecificHeat,
+  Entropy
+};
+
+namespace Detail {
+template <QuantityKind Kind>
+struct DimensionOf;
+
+template <>
+struct DimensionOf<QuantityKind::Length> : std::type_identity<Length> {};
+template <>
+struct DimensionOf<QuantityKind::Density> : std::type_identity<Density> {};
+template <>
+struct DimensionOf<QuantityKind::Time> : std::type_identity<Time> {};
+template <>
+struct DimensionOf<QuantityKind::Temperature>
+    : std::type_identity<Temperature> {};
+template <>
+struct DimensionOf<QuantityKind::Mass> : std::type_identity<Mass> {};
+template <>
+struct DimensionOf<QuantityKind::Velocity> : std::type_identity<Velocity> {};
+template <>
+struct DimensionOf<QuantityKind::Acceleration>
+    : std::type_identity<Acceleration> {};
+template <>
+struct DimensionOf<QuantityKind::Force> : std::type_identity<Force> {};
+template <>
+struct DimensionOf<QuantityKind::Traction> : std::type_identity<Traction> {};
+template <>
+struct DimensionOf<QuantityKind::Moment> : std::type_identity<Moment> {};
+template <>
+struct DimensionOf<QuantityKind::Potential> : std::type_identity<Potential> {};
+template <>
+struct DimensionOf<QuantityKind::Energy> : std::type_identity<Energy> {};
+template <>
+struct DimensionOf<QuantityKind::HeatFlux> : std::type_identity<HeatFlux> {};
+template <>
+struct DimensionOf<QuantityKind::ThermalConductivity>
+    : std::type_identity<ThermalConductivity> {};
+template <>
+struct DimensionOf<QuantityKind::SpecificHeat>
+    : std::type_identity<SpecificHeat> {};
+template <>
+struct DimensionOf<QuantityKind::Entropy> : std::type_identity<Entropy> {};
+}  // namespace Detail
+
+/**
+ * @brief The `Dimension` type of a quantity selected at compile time.
+ */
+template <QuantityKind Kind>
+using DimensionOf = typename Detail::DimensionOf<Kind>::type;
+
+/**
+ * @brief Invokes `f` with a value of the `Dimension` type corresponding to a
+ * quantity selected at runtime.
+ *
+ * @details This lets code that is templated on the dimension be reached
+ * from a runtime `QuantityKind` through a single switch.
+ *
+ * @param kind The physical quantity.
+ * @param f A callable accepting any `Dimension` type by value.
+ * @return The result of the call.
+ */
+template <typename F>
+DIMENSIONS_HOST_DEVICE constexpr decltype(auto) VisitDimension(
+    QuantityKind kind, F&& f) {
+  switch (kind) {
+    case QuantityKind::Length:
+      return f(Length{});
+    case QuantityKind::Density:
+      return f(Density{});
+    case QuantityKind::Time:
+      return f(Time{});
+    case QuantityKind::Temperature:
+      return f(Temperature{});
+    case QuantityKind::Mass:
+      return f(Mass{});
+    case QuantityKind::Velocity:
+      return f(Velocity{});
+    case QuantityKind::Acceleration:
+      return f(Acceleration{});
+    case QuantityKind::Force:
+      return f(Force{});
+    case QuantityKind::Traction:
+      return f(Traction{});
+    case QuantityKind::Moment:
+      return f(Moment{});
+    case QuantityKind::Potential:
+      return f(Potential{});
+    case QuantityKind::Energy:
+      return f(Energy{});
+    case QuantityKind::HeatFlux:
+      return f(HeatFlux{});
+    case QuantityKind::ThermalConductivity:
+      return f(ThermalConductivity{});
+    case QuantityKind::SpecificHeat:
+      return f(SpecificHeat{});
+    case QuantityKind::Entropy:
+      return f(Entropy{});
+  }
+  return f(Dimensionless{});
+}
+
+}  // namespace Dimensions
@@ -1,7 +1,20 @@
 #pragma once
 
 #include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <vector>
 
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/DoubleWord.hpp"
+#include "Dimensions/Instrumentation.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "Dimensions/Portability.hpp"
+#include "Dimensions/Quantity.hpp"
 #include "NumericConcepts/NumericConcepts.hpp"
 
 /**
@@ -13,6 +26,200 @@
 
 namespace Dimensions {
 
+namespace Detail {
+
+/**
+ * @brief Selects the type in which derived scales are accumulated.
+ *
+ * @details Products of several base scales raised to powers overflow or
+ * underflow single precision long before the final factor does, e.g. L^5 for
+ * astrophysical lengths. Scales for `float` systems are therefore accumulated
+ * in `double` and rounded once. Defining `DIMENSIONS_EXTENDED_DOUBLE_SCALES`
+ * extends the same treatment to `double` systems using `long double`, and
+ * defining `DIMENSIONS_COMPENSATED_SCALES` does so using `DoubleWord<double>`,
+ * whose precision does not depend on the platform. Under the latter option
+ * every `double` scale is rounded once from a value accurate to about 2^-100,
+ * so it is the correctly rounded scale whichever accessor forms it, except in
+ * rare cases within that distance of a rounding boundary.
+ */
+template <typename Real>
+struct ExtendedPrecision {
+  using type = Real;
+};
+
+template <>
+struct ExtendedPrecision<float> {
+  using type = double;
+};
+
+#if defined(DIMENSIONS_COMPENSATED_SCALES)
+template <>
+struct ExtendedPrecision<double> {
+  using type = DoubleWord<double>;
+};
+#elif defined(DIMENSIONS_EXTENDED_DOUBLE_SCALES)
+template <>
+struct ExtendedPrecision<double> {
+  using type = long double;
+};
+#endif
+
+/**
+ * @brief Selects the type in which compensated scales are accumulated.
+ *
+ * @details This carries at least twice the precision of `Real`, so that the
+ * scale can be rounded to a `DoubleWord<Real>` correction as well as to
+ * `Real`. For `float`, `double` gives both the precision and the range.
+ */
+template <std::floating_point Real>
+struct CompensatedPrecision {
+  using type = DoubleWord<Real>;
+};
+
+template <>
+struct CompensatedPrecision<float> {
+  using type = double;
+};
+
+/**
+ * @brief Returns true if `x` rounds to a finite, normal `Real` or is zero.
+ */
+template <typename Real, typename Extended>
+DIMENSIONS_HOST_DEVICE constexpr bool IsRepresentable(Extended x) noexcept {
+  const auto magnitude = x < 0 ? -x : x;
+  if (magnitude == 0) return true;
+  return magnitude <= static_cast<Extended>(std::numeric_limits<Real>::max()) &&
+         magnitude >= static_cast<Extended>(std::numeric_limits<Real>::min());
+}
+
+/**
+ * @brief Raises `x` to a non-negative integer power by repeated squaring.
+ */
+template <unsigned N, typename Real>
+DIMENSIONS_HOST_DEVICE constexpr Real UnsignedPower(Real x) noexcept {
+  if constexpr (N == 0) {
+    return static_cast<Real>(1);
+  } else if constexpr (N == 1) {
+    return x;
+  } else {
+    const auto half = UnsignedPower<N / 2>(x);
+    if constexpr (N % 2 == 0) {
+      return half * half;
+    } else {
+      return half * half * x;
+    }
+  }
+}
+
+/**
+ * @brief Returns `x` raised to `N` if `N` is positive and one otherwise.
+ */
+template <int N, typename Real>
+DIMENSIONS_HOST_DEVICE constexpr Real PositivePart(Real x) noexcept {
+  if constexpr (N > 0) {
+    return UnsignedPower<static_cast<unsigned>(N)>(x);
+  } else {
+    return static_cast<Real>(1);
+  }
+}
+
+/**
+ * @brief Evaluates a^A b^B c^C d^D with at most one division.
+ *
+ * @details The factors with positive exponents form the numerator and those
+ * with negative exponents the denominator, so that the division is omitted
+ * entirely when no exponent is negative.
+ */
+template <typename Real, int A, int B, int C, int D>
+DIMENSIONS_HOST_DEVICE constexpr Real PowerProduct(Real a, Real b, Real c,
+                                                  Real d) noexcept {
+  const auto numerator = PositivePart<A>(a) * PositivePart<B>(b) *
+                         PositivePart<C>(c) * PositivePart<D>(d);
+  if constexpr (A >= 0 && B >= 0 && C >= 0 && D >= 0) {
+    return numerator;
+  } else {
+    const auto denominator = PositivePart<-A>(a) * PositivePart<-B>(b) *
+                             PositivePart<-C>(c) * PositivePart<-D>(d);
+    return numerator / denominator;
+  }
+}
+
+/**
+ * @brief Raises `x` to a non-negative integer power known only at runtime.
+ * @details The products are formed in the same order as by the compile-time
+ * overload, so the two give identical results.
+ */
+template <typename Real>
+DIMENSIONS_HOST_DEVICE constexpr Real UnsignedPower(Real x,
+                                                    unsigned n) noexcept {
+  if (n == 0) return static_cast<Real>(1);
+  if (n == 1) return x;
+  const auto half = UnsignedPower(x, n / 2);
+  return n % 2 == 0 ? half * half : half * half * x;
+}
+
+/**
+ * @brief Returns `x` raised to `n` if `n` is positive and one otherwise.
+ */
+template <typename Real>
+DIMENSIONS_HOST_DEVICE constexpr Real PositivePart(Real x, int n) noexcept {
+  return n > 0 ? UnsignedPower(x, static_cast<unsigned>(n))
+               : static_cast<Real>(1);
+}
+
+/**
+ * @brief Evaluates a^A b^B c^C d^D for exponents known only at runtime, with
+ * the same operations as the compile-time overload.
+ */
+template <typename Real>
+DIMENSIONS_HOST_DEVICE constexpr Real PowerProduct(Real a, Real b, Real c,
+                                                  Real d, int A, int B, int C,
+                                                  int D) noexcept {
+  const auto numerator = PositivePart(a, A) * PositivePart(b, B) *
+                         PositivePart(c, C) * PositivePart(d, D);
+  if (A >= 0 && B >= 0 && C >= 0 && D >= 0) return numerator;
+  const auto denominator = PositivePart(a, -A) * PositivePart(b, -B) *
+                           PositivePart(c, -C) * PositivePart(d, -D);
+  return numerator / denominator;
+}
+
+/** @brief The Newtonian constant of gravitation in SI units. */
+template <typename Real>
+inline constexpr Real GravitationalConstantSI =
+    static_cast<Real>(6.67430e-11L);
+
+/** @brief The Boltzmann constant in SI units. */
+template <typename Real>
+inline constexpr Real BoltzmannConstantSI = static_cast<Real>(1.380649e-23L);
+
+}  // namespace Detail
+
+/**
+ * @brief The base scales of a unit system as a structural value type.
+ *
+ * @details All members are public and of literal type, so values of this
+ * type can be used as non-type template arguments. This allows kernels of
+ * the form `template <auto System> void Kernel()` to be specialised for a
+ * particular unit system, with every factor known to the compiler. Values
+ * are produced by `Dimensions::Constants` and consumed by
+ * `ConstantDimensions`.
+ *
+ * @tparam Real The numeric type of the scales. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <NumericConcepts::Real Real = double>
+struct SystemConstants {
+  using ValueType = Real;
+
+  Real lengthScale = 1;
+  Real densityScale = 1;
+  Real timeScale = 1;
+  Real temperatureScale = 1;
+
+  friend constexpr bool operator==(const SystemConstants&,
+                                   const SystemConstants&) noexcept = default;
+};
+
 /**
  * @brief A base class for dimensional analysis using the CRTP pattern.
  *
@@ -28,10 +235,22 @@ namespace Dimensions {
 template <typename Derived_, NumericConcepts::Real Real = double>
 class Dimensions {
  private:
-  const Real gravitationalConstant_ = static_cast<Real>(6.67430e-11);
-  const Real boltzmannConstant_ = static_cast<Real>(1.380649e-23);
+  using Extended = typename Detail::ExtendedPrecision<Real>::type;
+
+  // Physical constants in SI units. These are static so that unit-system
+  // objects carry no data and can benefit from empty-base optimisation.
+  static constexpr Extended gravitationalConstant_ =
+      Detail::GravitationalConstantSI<Extended>;
+  static constexpr Extended boltzmannConstant_ =
+      Detail::BoltzmannConstantSI<Extended>;
 
  public:
+  /**
+   * @brief The type in which derived scales are accumulated before being
+   * rounded to `Real`.
+   */
+  using ExtendedReal = Extended;
+
   /** @name Base Scale Interface
    * @brief Methods that must be implemented by the inheriting class.
    * @{
@@ -41,7 +260,7 @@ class Dimensions {
    * @brief Retrieves the base length scale from the derived class.
    * @return The length scaling factor.
    */
-  constexpr auto LengthScale() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr auto LengthScale() const noexcept {
     return Derived().LengthScale();
   }
 
@@ -49,7 +268,7 @@ class Dimensions {
    * @brief Retrieves the base density scale from the derived class.
    * @return The density scaling factor.
    */
-  constexpr auto DensityScale() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr auto DensityScale() const noexcept {
     return Derived().DensityScale();
   }
 
@@ -57,105 +276,774 @@ class Dimensions {
    * @brief Retrieves the base time scale from the derived class.
    * @return The time scaling factor.
    */
-  constexpr auto TimeScale() const noexcept { return Derived().TimeScale(); }
+  DIMENSIONS_HOST_DEVICE constexpr auto TimeScale() const noexcept {
+    return Derived().TimeScale();
+  }
 
   /**
    * @brief Retrieves the base temperature scale from the derived class.
    * @return The temperature scaling factor.
    */
-  constexpr auto TemperatureScale() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr auto TemperatureScale() const noexcept {
     return Derived().TemperatureScale();
   }
+
+  /**
+   * @brief Returns the base scales of this system as a structural value.
+   * @return The base scales, suitable for use as a template argument.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr SystemConstants<Real> Constants()
+      const noexcept {
+    return {.lengthScale = Derived().LengthScale(),
+            .densityScale = Derived().DensityScale(),
+            .timeScale = Derived().TimeScale(),
+            .temperatureScale = Derived().TemperatureScale()};
+  }
   /** @} */
 
   /** @name Derived Scales and Dimensionless Constants
    * @brief Methods that are automatically derived from the base scales.
+   * @details Each named scale is an alias for the generic `Scale` accessor
+   * with the exponents of the corresponding physical dimension.
    * @{
    */
 
+  /**
+   * @brief Calculates the scaling factor for the dimension L^L M^M T^T Θ^Theta
+   * in the extended accumulation type.
+   *
+   * @details The factor is built from the base scales, with mass expressed
+   * through the density scale as M = ρ L^3. Each base scale is raised to its
+   * exponent by repeated squaring, and factors with negative exponents are
+   * gathered into a single divisor. All intermediate products are formed in
+   * `ExtendedReal`, so that they cannot overflow where the final factor does
+   * not.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The unrounded scaling factor.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Extended ExtendedScale() const noexcept {
+    return Derived().template AccumulatedScale<Extended, L, M, T, Theta>();
+  }
+
+  /**
+   * @brief Calculates the unrounded scaling factor for a dimension whose
+   * exponents are known only at runtime.
+   *
+   * @details The factor is formed by the same operations as the compile-time
+   * overload, so the two give identical results for the same exponents.
+   *
+   * @param l The exponent of length.
+   * @param m The exponent of mass.
+   * @param t The exponent of time.
+   * @param theta The exponent of temperature.
+   * @return The unrounded scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr Extended ExtendedScale(
+      int l, int m, int t, int theta) const noexcept {
+    return Derived().template AccumulatedScale<Extended>(l, m, t, theta);
+  }
+
+  /**
+   * @brief Calculates the scaling factor for the dimension L^L M^M T^T Θ^Theta
+   * in a given accumulation type.
+   *
+   * @details This is the evaluation behind `ExtendedScale` and
+   * `CompensatedScale`. Helpers that form scales from other base quantities,
+   * such as `MechanicalMassDimensions`, override it so that every
+   * accumulation type follows the same formulation.
+   *
+   * @tparam Accumulator The type in which the factor is formed.
+   * @return The unrounded scaling factor.
+   */
+  template <typename Accumulator, int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale()
+      const noexcept {
+    return Detail::PowerProduct<Accumulator, L + 3 * M, M, T, Theta>(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().DensityScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()));
+  }
+
+  /**
+   * @brief Calculates the scaling factor for exponents known only at runtime
+   * in a given accumulation type.
+   */
+  template <typename Accumulator>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale(
+      int l, int m, int t, int theta) const noexcept {
+    return Detail::PowerProduct(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().DensityScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()), l + 3 * m, m,
+        t, theta);
+  }
+
+  /**
+   * @brief Calculates the scaling factor for the dimension L^L M^M T^T Θ^Theta.
+   *
+   * @details The factor is evaluated by `ExtendedScale` and rounded once to
+   * `Real`. Factors outside the range of `Real` become infinite or zero; use
+   * `TryScale` to detect this.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The scaling factor.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Real Scale() const noexcept {
+    return static_cast<Real>(
+        Derived().template ExtendedScale<L, M, T, Theta>());
+  }
+
+  /**
+   * @brief Calculates the scaling factor for a `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The scaling factor.
+   */
+  template <PhysicalDimension Dim>
+  DIMENSIONS_HOST_DEVICE constexpr Real Scale() const noexcept {
+    return Derived()
+        .template Scale<Dim::Length, Dim::Mass, Dim::Time, Dim::Temperature>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for the dimension L^L M^M T^T Θ^Theta
+   * if it is representable in `Real`.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The scaling factor, or an empty optional if it would overflow,
+   * underflow into the subnormal range, or is not a number.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  constexpr std::optional<Real> TryScale() const noexcept {
+    const auto factor = Derived().template ExtendedScale<L, M, T, Theta>();
+    if (!Detail::IsRepresentable<Real>(factor)) return std::nullopt;
+    return static_cast<Real>(factor);
+  }
+
+  /**
+   * @brief Calculates the scaling factor for a `Dimension` type if it is
+   * representable in `Real`.
+   * @tparam Dim The physical dimension.
+   * @return The scaling factor, or an empty optional.
+   */
+  template <PhysicalDimension Dim>
+  constexpr std::optional<Real> TryScale() const noexcept {
+    return TryScale<Dim::Length, Dim::Mass, Dim::Time, Dim::Temperature>();
+  }
+
+  /**
+   * @brief Calculates the reciprocal of the scaling factor for the dimension
+   * L^L M^M T^T Θ^Theta.
+   *
+   * @details This is evaluated directly as the scale of the inverse dimension,
+   * so that nondimensionalisation can be performed by multiplication.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The reciprocal scaling factor.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale() const noexcept {
+    return Derived().template Scale<-L, -M, -T, -Theta>();
+  }
+
+  /**
+   * @brief Calculates the reciprocal scaling factor for a `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The reciprocal scaling factor.
+   */
+  template <PhysicalDimension Dim>
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale() const noexcept {
+    return Derived().template Scale<DimensionInverse<Dim>>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for the dimension L^L M^M T^T Θ^Theta
+   * as a double-word value.
+   *
+   * @details The factor is accumulated in double-word arithmetic and rounded
+   * once, so its leading part is the correctly rounded scale, except in rare
+   * cases very close to a rounding boundary, and its trailing part holds the
+   * next `Real` digits. Passing the result to `Kernels::Multiply` scales data
+   * with one fused multiply-add per element whose result is rounded once.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The scaling factor as the sum of two `Real`s.
+   */
+  template <int L, int M, int T, int Theta = 0>
+    requires std::floating_point<Real>
+  DIMENSIONS_HOST_DEVICE constexpr DoubleWord<Real> CompensatedScale()
+      const noexcept {
+    using Accumulator = typename Detail::CompensatedPrecision<Real>::type;
+    return DoubleWord<Real>(
+        Derived().template AccumulatedScale<Accumulator, L, M, T, Theta>());
+  }
+
+  /**
+   * @brief Calculates the double-word scaling factor for a `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The scaling factor as the sum of two `Real`s.
+   */
+  template <PhysicalDimension Dim>
+    requires std::floating_point<Real>
+  DIMENSIONS_HOST_DEVICE constexpr DoubleWord<Real> CompensatedScale()
+      const noexcept {
+    return CompensatedScale<Dim::Length, Dim::Mass, Dim::Time,
+                            Dim::Temperature>();
+  }
+
+  /**
+   * @brief Calculates the double-word reciprocal scaling factor for a
+   * `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The reciprocal scaling factor as the sum of two `Real`s.
+   */
+  template <PhysicalDimension Dim>
+    requires std::floating_point<Real>
+  DIMENSIONS_HOST_DEVICE constexpr DoubleWord<Real> CompensatedInverseScale()
+      const noexcept {
+    return CompensatedScale<DimensionInverse<Dim>>();
+  }
+
   /**
    * @brief Calculates the dimensionless Gravitational Constant (G) in this
    * system.
    * @return The dimensionless value of G.
    */
-  constexpr auto GravitationalConstant() const noexcept {
-    const auto t_scale = TimeScale();
-    return gravitationalConstant_ * DensityScale() * t_scale * t_scale;
+  DIMENSIONS_HOST_DEVICE constexpr auto GravitationalConstant() const noexcept {
+    return static_cast<Real>(gravitationalConstant_ *
+                             Derived().template ExtendedScale<-3, 1, 2, 0>());
   }
 
   /**
    * @brief Calculates the dimensionless Boltzmann Constant (kB) in this system.
    * @return The dimensionless value of kB.
    */
-  constexpr auto BoltzmannConstant() const noexcept {
-    return boltzmannConstant_ * TemperatureScale() / EnergyScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto BoltzmannConstant() const noexcept {
+    return static_cast<Real>(boltzmannConstant_ *
+                             Derived().template ExtendedScale<-2, -1, 2, 1>());
   }
 
   /**
    * @brief Calculates the scaling factor for mass.
    * @return The derived mass scaling factor.
    */
-  constexpr auto MassScale() const noexcept {
-    const auto l_scale = LengthScale();
-    return DensityScale() * l_scale * l_scale * l_scale;
+  DIMENSIONS_HOST_DEVICE constexpr auto MassScale() const noexcept {
+    return Derived().template Scale<Mass>();
   }
 
   /**
    * @brief Calculates the scaling factor for velocity.
    * @return The derived velocity scaling factor.
    */
-  constexpr auto VelocityScale() const noexcept {
-    return LengthScale() / TimeScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto VelocityScale() const noexcept {
+    return Derived().template Scale<Velocity>();
   }
 
   /**
    * @brief Calculates the scaling factor for acceleration.
    * @return The derived acceleration scaling factor.
    */
-  constexpr auto AccelerationScale() const noexcept {
-    return VelocityScale() / TimeScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto AccelerationScale() const noexcept {
+    return Derived().template Scale<Acceleration>();
   }
 
   /**
    * @brief Calculates the scaling factor for force.
    * @return The derived force scaling factor.
    */
-  constexpr auto ForceScale() const noexcept {
-    return MassScale() * AccelerationScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto ForceScale() const noexcept {
+    return Derived().template Scale<Force>();
   }
 
   /**
    * @brief Calculates the scaling factor for traction (pressure/stress).
    * @return The derived traction scaling factor.
    */
-  constexpr auto TractionScale() const noexcept {
-    const auto l_scale = LengthScale();
-    return ForceScale() / (l_scale * l_scale);
+  DIMENSIONS_HOST_DEVICE constexpr auto TractionScale() const noexcept {
+    return Derived().template Scale<Traction>();
   }
 
   /**
    * @brief Calculates the scaling factor for moment or torque.
    * @return The derived moment scaling factor.
    */
-  constexpr auto MomentScale() const noexcept {
-    return ForceScale() * LengthScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto MomentScale() const noexcept {
+    return Derived().template Scale<Moment>();
   }
 
   /**
    * @brief Calculates the scaling factor for potential (energy per unit mass).
    * @return The derived potential scaling factor.
    */
-  constexpr auto PotentialScale() const noexcept {
-    return AccelerationScale() * LengthScale();
+  DIMENSIONS_HOST_DEVICE constexpr auto PotentialScale() const noexcept {
+    return Derived().template Scale<Potential>();
   }
 
   /**
    * @brief Calculates the scaling factor for energy.
    * @return The derived energy scaling factor.
    */
-  constexpr auto EnergyScale() const noexcept {
-    const auto v_scale = VelocityScale();
-    return MassScale() * v_scale * v_scale;
+  DIMENSIONS_HOST_DEVICE constexpr auto EnergyScale() const noexcept {
+    return Derived().template Scale<Energy>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for heat flux (power per unit area).
+   * @return The derived heat flux scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto HeatFluxScale() const noexcept {
+    return Derived().template Scale<HeatFlux>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for thermal conductivity.
+   * @return The derived thermal conductivity scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto ThermalConductivityScale()
+      const noexcept {
+    return Derived().template Scale<ThermalConductivity>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for specific heat capacity.
+   * @return The derived specific heat scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto SpecificHeatScale() const noexcept {
+    return Derived().template Scale<SpecificHeat>();
+  }
+
+  /**
+   * @brief Calculates the scaling factor for entropy (or heat capacity).
+   * @return The derived entropy scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto EntropyScale() const noexcept {
+    return Derived().template Scale<Entropy>();
+  }
+
+  /**
+   * @brief Returns the scaling factor for a quantity selected at runtime.
+   * @param kind The physical quantity.
+   * @return The corresponding scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr Real Scale(
+      QuantityKind kind) const noexcept {
+    switch (kind) {
+      case QuantityKind::Length:
+        return Derived().LengthScale();
+      case QuantityKind::Density:
+        return Derived().DensityScale();
+      case QuantityKind::Time:
+        return Derived().TimeScale();
+      case QuantityKind::Temperature:
+        return Derived().TemperatureScale();
+      case QuantityKind::Mass:
+        return Derived().MassScale();
+      case QuantityKind::Velocity:
+        return Derived().VelocityScale();
+      case QuantityKind::Acceleration:
+        return Derived().AccelerationScale();
+      case QuantityKind::Force:
+        return Derived().ForceScale();
+      case QuantityKind::Traction:
+        return Derived().TractionScale();
+      case QuantityKind::Moment:
+        return Derived().MomentScale();
+      case QuantityKind::Potential:
+        return Derived().PotentialScale();
+      case QuantityKind::Energy:
+        return Derived().EnergyScale();
+      case QuantityKind::HeatFlux:
+        return Derived().HeatFluxScale();
+      case QuantityKind::ThermalConductivity:
+        return Derived().ThermalConductivityScale();
+      case QuantityKind::SpecificHeat:
+        return Derived().SpecificHeatScale();
+      case QuantityKind::Entropy:
+        return Derived().EntropyScale();
+    }
+    return static_cast<Real>(1);
+  }
+
+  /**
+   * @brief Returns the reciprocal scaling factor for a quantity selected at
+   * runtime.
+   * @param kind The physical quantity.
+   * @return The corresponding reciprocal scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale(
+      QuantityKind kind) const noexcept {
+    return VisitDimension(kind, [this]<typename Dim>(Dim) {
+      return Derived().template InverseScale<Dim>();
+    });
+  }
+  /** @} */
+
+  /** @name Batch Conversion
+   * @brief Methods that apply a scaling factor to contiguous data.
+   * @details The factor is evaluated once per call, and the data is then
+   * scaled using the vectorised kernels in `Kernels.hpp`. Nondimensionalising
+   * multiplies by `InverseScale`, so no division is performed per element.
+   * When `DIMENSIONS_ENABLE_INSTRUMENTATION` is defined each call is also
+   * counted, as described in `Instrumentation.hpp`.
+   * @{
+   */
+
+  /**
+   * @brief Converts dimensional values to nondimensional form in place.
+   * @param values The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  void Nondimensionalise(std::span<Real> values,
+                         QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+    Kernels::Multiply(values, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts dimensional values to nondimensional form.
+   * @param in The dimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  void Nondimensionalise(std::span<const Real> in, std::span<Real> out,
+                         QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply(in, out, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts nondimensional values to dimensional form in place.
+   * @param values The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  void Redimensionalise(std::span<Real> values,
+                        QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+    Kernels::Multiply(values, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts nondimensional values to dimensional form.
+   * @param in The nondimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  void Redimensionalise(std::span<const Real> in, std::span<Real> out,
+                        QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply(in, out, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts dimensional values stored in one floating-point type to
+   * nondimensional values stored in another.
+   *
+   * @details The factor is applied in `Real`, and the conversions between
+   * the storage types and `Real` are fused with the scaling in one pass. This
+   * allows, for example, a `double` system to read `float` or `_Float16`
+   * checkpoint data directly into a `double` working array.
+   *
+   * @tparam In The storage type of the input.
+   * @tparam Out The storage type of the output.
+   * @param in The dimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::StorageReal In, Kernels::StorageReal Out>
+    requires(!std::is_same_v<In, Real> || !std::is_same_v<Out, Real>)
+  void Nondimensionalise(std::span<const In> in, std::span<Out> out,
+                         QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply(in, out, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts nondimensional values stored in one floating-point type
+   * to dimensional values stored in another.
+   * @details The factor is applied in `Real` as for `Nondimensionalise`.
+   * @tparam In The storage type of the input.
+   * @tparam Out The storage type of the output.
+   * @param in The nondimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::StorageReal In, Kernels::StorageReal Out>
+    requires(!std::is_same_v<In, Real> || !std::is_same_v<Out, Real>)
+  void Redimensionalise(std::span<const In> in, std::span<Out> out,
+                        QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply(in, out, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts dimensional complex or tensor values to nondimensional
+   * form in place.
+   *
+   * @details Every real component of each element is multiplied by the same
+   * factor, so the data is scaled as a packed array of `Real` at full vector
+   * width.
+   *
+   * @tparam T A packed element type whose components are `Real`, such as
+   * `std::complex<Real>` or `std::array<Real, N>`.
+   * @param values The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::PackedReal T>
+    requires std::is_same_v<Kernels::PackedScalar<T>, Real>
+  void Nondimensionalise(std::span<T> values,
+                         QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+    Kernels::Multiply(values, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts dimensional complex or tensor values to nondimensional
+   * form.
+   * @tparam T A packed element type whose components are `Real`.
+   * @param in The dimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::PackedReal T>
+    requires std::is_same_v<Kernels::PackedScalar<T>, Real>
+  void Nondimensionalise(std::type_identity_t<std::span<const T>> in,
+                         std::span<T> out, QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply<T>(in, out, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts nondimensional complex or tensor values to dimensional
+   * form in place.
+   * @tparam T A packed element type whose components are `Real`.
+   * @param values The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::PackedReal T>
+    requires std::is_same_v<Kernels::PackedScalar<T>, Real>
+  void Redimensionalise(std::span<T> values,
+                        QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+    Kernels::Multiply(values, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts nondimensional complex or tensor values to dimensional
+   * form.
+   * @tparam T A packed element type whose components are `Real`.
+   * @param in The nondimensional data.
+   * @param out The destination, which must be the same size as `in`.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <Kernels::PackedReal T>
+    requires std::is_same_v<Kernels::PackedScalar<T>, Real>
+  void Redimensionalise(std::type_identity_t<std::span<const T>> in,
+                        std::span<T> out, QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::Multiply<T>(in, out, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts interleaved multi-component records to nondimensional
+   * form in place.
+   * @details Each component is scaled by its own factor in a single pass.
+   * Trailing values that do not form a complete record are not converted.
+   * @param values Consecutive records of `components.size()` values.
+   * @param components The physical quantity of each component of a record.
+   */
+  void Nondimensionalise(std::span<Real> values,
+                         std::span<const QuantityKind> components) const {
+    const auto factors = InverseScales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, values.size(),
+        2 * values.size_bytes());
+    Kernels::MultiplyInterleaved(values, std::span<const Real>(factors));
+  }
+
+  /**
+   * @brief Converts interleaved multi-component records to nondimensional
+   * form.
+   * @details Trailing values that do not form a complete record are not
+   * written.
+   * @param in Consecutive records of `components.size()` dimensional values.
+   * @param out The destination, which must be the same size as `in`.
+   * @param components The physical quantity of each component of a record.
+   */
+  void Nondimensionalise(std::span<const Real> in, std::span<Real> out,
+                         std::span<const QuantityKind> components) const {
+    const auto factors = InverseScales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::MultiplyInterleaved(in, out, std::span<const Real>(factors));
+  }
+
+  /**
+   * @brief Converts interleaved multi-component records to dimensional form
+   * in place.
+   * @details Each component is scaled by its own factor in a single pass.
+   * Trailing values that do not form a complete record are not converted.
+   * @param values Consecutive records of `components.size()` values.
+   * @param components The physical quantity of each component of a record.
+   */
+  void Redimensionalise(std::span<Real> values,
+                        std::span<const QuantityKind> components) const {
+    const auto factors = Scales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, values.size(),
+        2 * values.size_bytes());
+    Kernels::MultiplyInterleaved(values, std::span<const Real>(factors));
+  }
+
+  /**
+   * @brief Converts interleaved multi-component records to dimensional form.
+   * @details Trailing values that do not form a complete record are not
+   * written.
+   * @param in Consecutive records of `components.size()` nondimensional
+   * values.
+   * @param out The destination, which must be the same size as `in`.
+   * @param components The physical quantity of each component of a record.
+   */
+  void Redimensionalise(std::span<const Real> in, std::span<Real> out,
+                        std::span<const QuantityKind> components) const {
+    const auto factors = Scales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, in.size(),
+        in.size_bytes() + out.size_bytes());
+    Kernels::MultiplyInterleaved(in, out, std::span<const Real>(factors));
+  }
+
+#if DIMENSIONS_HAS_MDSPAN
+  /**
+   * @brief Converts a rank-one `mdspan` with any layout to nondimensional
+   * form in place.
+   * @param field The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <typename Extents, typename Layout, typename Accessor>
+    requires(Extents::rank() == 1)
+  void Nondimensionalise(std::mdspan<Real, Extents, Layout, Accessor> field,
+                         QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), field.size(),
+        2 * field.size() * sizeof(Real));
+    Kernels::Multiply(field, Derived().InverseScale(kind));
+  }
+
+  /**
+   * @brief Converts a rank-one `mdspan` with any layout to dimensional form in
+   * place.
+   * @param field The data to be converted.
+   * @param kind The physical quantity that the data represents.
+   */
+  template <typename Extents, typename Layout, typename Accessor>
+    requires(Extents::rank() == 1)
+  void Redimensionalise(std::mdspan<Real, Extents, Layout, Accessor> field,
+                        QuantityKind kind) const noexcept {
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::Slot(kind), field.size(),
+        2 * field.size() * sizeof(Real));
+    Kernels::Multiply(field, Derived().Scale(kind));
+  }
+
+  /**
+   * @brief Converts a rank-two `mdspan` of records to nondimensional form in
+   * place, with one quantity for each column.
+   * @param field The data, with one record per row.
+   * @param components The physical quantity of each column.
+   */
+  template <typename Extents, typename Layout, typename Accessor>
+    requires(Extents::rank() == 2)
+  void Nondimensionalise(std::mdspan<Real, Extents, Layout, Accessor> field,
+                         std::span<const QuantityKind> components) const {
+    const auto factors = InverseScales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, field.size(),
+        2 * field.size() * sizeof(Real));
+    Kernels::MultiplyComponents(field, std::span<const Real>(factors));
+  }
+
+  /**
+   * @brief Converts a rank-two `mdspan` of records to dimensional form in
+   * place, with one quantity for each column.
+   * @param field The data, with one record per row.
+   * @param components The physical quantity of each column.
+   */
+  template <typename Extents, typename Layout, typename Accessor>
+    requires(Extents::rank() == 2)
+  void Redimensionalise(std::mdspan<Real, Extents, Layout, Accessor> field,
+                        std::span<const QuantityKind> components) const {
+    const auto factors = Scales(components);
+    DIMENSIONS_INSTRUMENT_CONVERSION(
+        Instrumentation::InterleavedSlot, field.size(),
+        2 * field.size() * sizeof(Real));
+    Kernels::MultiplyComponents(field, std::span<const Real>(factors));
+  }
+#endif
+  /** @} */
+
+  /** @name Quantity Conversion
+   * @brief Methods that convert between `Quantity` values and nondimensional
+   * values in this system.
+   * @{
+   */
+
+  /**
+   * @brief Converts a quantity to its nondimensional value.
+   * @tparam Dim The physical dimension of the quantity.
+   * @param quantity The quantity in SI units.
+   * @return The nondimensional value.
+   */
+  template <PhysicalDimension Dim>
+  constexpr Real Nondimensionalise(
+      Quantity<Dim, Real> quantity) const noexcept {
+    return quantity.Value() * Derived().template InverseScale<Dim>();
+  }
+
+  /**
+   * @brief Converts a nondimensional value to a quantity.
+   * @tparam Dim The physical dimension of the quantity.
+   * @param value The nondimensional value.
+   * @return The quantity in SI units.
+   */
+  template <PhysicalDimension Dim>
+  constexpr auto Redimensionalise(Real value) const noexcept {
+    return Quantity<Dim, Real>(value * Derived().template Scale<Dim>());
   }
   /** @} */
 
@@ -164,9 +1052,27 @@ class Dimensions {
    * @brief Provides access to the final derived class instance via CRTP.
    * @return A const reference to the derived class.
    */
-  constexpr const auto& Derived() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr const auto& Derived() const noexcept {
     return static_cast<const Derived_&>(*this);
   }
+
+  /** @brief Returns the scaling factors for a list of quantities. */
+  std::vector<Real> Scales(std::span<const QuantityKind> kinds) const {
+    auto factors = std::vector<Real>(kinds.size());
+    for (std::size_t i = 0; i < kinds.size(); ++i) {
+      factors[i] = Derived().Scale(kinds[i]);
+    }
+    return factors;
+  }
+
+  /** @brief Returns the reciprocal scaling factors for a list of quantities. */
+  std::vector<Real> InverseScales(std::span<const QuantityKind> kinds) const {
+    auto factors = std::vector<Real>(kinds.size());
+    for (std::size_t i = 0; i < kinds.size(); ++i) {
+      factors[i] = Derived().InverseScale(kinds[i]);
+    }
+    return factors;
+  }
 };
 
 /**
@@ -187,7 +1093,7 @@ class MechanicalDimensions : public Dimensions<Derived_, Real> {
    * @brief Provides a default temperature scale of 1.0.
    * @return A scaling factor of 1.0 cast to the appropriate `Real` type.
    */
-  constexpr auto TemperatureScale() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr auto TemperatureScale() const noexcept {
     return static_cast<Real>(1.0);
   }
 };
@@ -206,30 +1112,227 @@ class MechanicalDimensions : public Dimensions<Derived_, Real> {
 template <typename Derived_, NumericConcepts::Real Real = double>
 class MechanicalMassDimensions : public MechanicalDimensions<Derived_, Real> {
  private:
-  constexpr const auto& Derived() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr const auto& Derived() const noexcept {
     return static_cast<const Derived_&>(*this);
   }
 
  public:
   /** @brief Retrieves the base length scale from the final derived class. */
-  constexpr auto LengthScale() const noexcept {
+  DIMENSIONS_HOST_DEVICE constexpr auto LengthScale() const noexcept {
     return Derived().LengthScale();
   }
 
   /** @brief Retrieves the base mass scale from the final derived class. */
-  constexpr auto MassScale() const noexcept { return Derived().MassScale(); }
+  DIMENSIONS_HOST_DEVICE constexpr auto MassScale() const noexcept {
+    return Derived().MassScale();
+  }
 
   /** @brief Retrieves the base time scale from the final derived class. */
-  constexpr auto TimeScale() const noexcept { return Derived().TimeScale(); }
+  DIMENSIONS_HOST_DEVICE constexpr auto TimeScale() const noexcept {
+    return Derived().TimeScale();
+  }
 
   /**
    * @brief Implements `DensityScale` using `MassScale` and `LengthScale`.
    * @return The computed density scaling factor.
    */
-  constexpr auto DensityScale() const noexcept {
-    const auto l_scale = Derived().LengthScale();
-    return MassScale() / (l_scale * l_scale * l_scale);
+  DIMENSIONS_HOST_DEVICE constexpr auto DensityScale() const noexcept {
+    return this->template Scale<Density>();
+  }
+
+  /**
+   * @brief Calculates the unrounded scaling factor for the dimension
+   * L^L M^M T^T Θ^Theta in a given accumulation type directly from the
+   * length, mass and time scales.
+   *
+   * @details This avoids forming the density scale as an intermediate, so that
+   * mass-bearing factors are not rounded through a division by L^3.
+   *
+   * @tparam Accumulator The type in which the factor is formed.
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The unrounded scaling factor.
+   */
+  template <typename Accumulator, int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale()
+      const noexcept {
+    return Detail::PowerProduct<Accumulator, L, M, T, Theta>(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().MassScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()));
+  }
+
+  /**
+   * @brief Calculates the scaling factor for exponents known only at runtime
+   * in a given accumulation type, as the compile-time overload does.
+   */
+  template <typename Accumulator>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale(
+      int l, int m, int t, int theta) const noexcept {
+    return Detail::PowerProduct(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().MassScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()), l, m, t,
+        theta);
   }
 };
 
-}  // namespace Dimensions
\ No newline at end of file
+/**
+ * @brief An intermediate helper that allows defining `MassScale` directly in
+ * a system where temperature is a primary variable.
+ *
+ * @details This mirrors `MechanicalMassDimensions`, but derives directly from
+ * `Dimensions`, so the final class must also provide `TemperatureScale`.
+ * Every scale, including the thermal scales such as `HeatFluxScale` and
+ * `EntropyScale`, is formed in a single pass from the length, mass, time and
+ * temperature scales, without rounding through the density or energy scales.
+ *
+ * @tparam Derived_ The final concrete class that implements the unit system.
+ * @tparam Real The numeric type for calculations. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <typename Derived_, NumericConcepts::Real Real = double>
+class ThermalMassDimensions : public Dimensions<Derived_, Real> {
+ private:
+  DIMENSIONS_HOST_DEVICE constexpr const auto& Derived() const noexcept {
+    return static_cast<const Derived_&>(*this);
+  }
+
+ public:
+  /** @brief Retrieves the base length scale from the final derived class. */
+  DIMENSIONS_HOST_DEVICE constexpr auto LengthScale() const noexcept {
+    return Derived().LengthScale();
+  }
+
+  /** @brief Retrieves the base mass scale from the final derived class. */
+  DIMENSIONS_HOST_DEVICE constexpr auto MassScale() const noexcept {
+    return Derived().MassScale();
+  }
+
+  /** @brief Retrieves the base time scale from the final derived class. */
+  DIMENSIONS_HOST_DEVICE constexpr auto TimeScale() const noexcept {
+    return Derived().TimeScale();
+  }
+
+  /**
+   * @brief Retrieves the base temperature scale from the final derived class.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto TemperatureScale() const noexcept {
+    return Derived().TemperatureScale();
+  }
+
+  /**
+   * @brief Implements `DensityScale` using `MassScale` and `LengthScale`.
+   * @return The computed density scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto DensityScale() const noexcept {
+    return this->template Scale<Density>();
+  }
+
+  /**
+   * @brief Calculates the unrounded scaling factor for the dimension
+   * L^L M^M T^T Θ^Theta in a given accumulation type directly from the
+   * length, mass, time and temperature scales.
+   *
+   * @tparam Accumulator The type in which the factor is formed.
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The unrounded scaling factor.
+   */
+  template <typename Accumulator, int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale()
+      const noexcept {
+    return Detail::PowerProduct<Accumulator, L, M, T, Theta>(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().MassScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()));
+  }
+
+  /**
+   * @brief Calculates the scaling factor for exponents known only at runtime
+   * in a given accumulation type, as the compile-time overload does.
+   */
+  template <typename Accumulator>
+  DIMENSIONS_HOST_DEVICE constexpr Accumulator AccumulatedScale(
+      int l, int m, int t, int theta) const noexcept {
+    return Detail::PowerProduct(
+        static_cast<Accumulator>(Derived().LengthScale()),
+        static_cast<Accumulator>(Derived().MassScale()),
+        static_cast<Accumulator>(Derived().TimeScale()),
+        static_cast<Accumulator>(Derived().TemperatureScale()), l, m, t,
+        theta);
+  }
+};
+
+/**
+ * @brief A unit system whose base scales are a non-type template argument.
+ *
+ * @details Objects of this class are empty, and every scale is a constant
+ * expression determined by the template argument alone. Passing a
+ * `SystemConstants` value as the template argument of a kernel, and forming
+ * a `ConstantDimensions` inside it, therefore lets the compiler propagate
+ * every factor into the generated code.
+ *
+ * @tparam Constants The base scales of the system.
+ */
+template <SystemConstants Constants>
+class ConstantDimensions
+    : public Dimensions<ConstantDimensions<Constants>,
+                        typename decltype(Constants)::ValueType> {
+ public:
+  using ValueType = typename decltype(Constants)::ValueType;
+
+  DIMENSIONS_HOST_DEVICE constexpr ValueType LengthScale() const noexcept {
+    return Constants.lengthScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr ValueType DensityScale() const noexcept {
+    return Constants.densityScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr ValueType TimeScale() const noexcept {
+    return Constants.timeScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr ValueType TemperatureScale() const noexcept {
+    return Constants.temperatureScale;
+  }
+};
+
+
+namespace Detail {
+
+/**
+ * @brief A unit system holding base scales by value, used to fill the table
+ * of a `RuntimeDimensions` and to describe the system that wrote a field
+ * file.
+ */
+template <NumericConcepts::Real Real>
+class RuntimeBaseScales : public Dimensions<RuntimeBaseScales<Real>, Real> {
+ public:
+  explicit constexpr RuntimeBaseScales(
+      const SystemConstants<Real>& constants) noexcept
+      : constants_{constants} {}
+
+  constexpr Real LengthScale() const noexcept {
+    return constants_.lengthScale;
+  }
+  constexpr Real DensityScale() const noexcept {
+    return constants_.densityScale;
+  }
+  constexpr Real TimeScale() const noexcept { return constants_.timeScale; }
+  constexpr Real TemperatureScale() const noexcept {
+    return constants_.temperatureScale;
+  }
+
+ private:
+  SystemConstants<Real> constants_;
+};
+
+}  // namespace Detail
+
+}  // namespace Dimensions
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+#include "Dimensions/DoubleWord.hpp"
+
+/**
+ * @file Dispatch.hpp
+ * @brief Batch scaling kernels selected at runtime for the host processor.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details The kernels declared here are defined in the compiled
+ * `Dimensions::Dispatch` library, built with the `DIMENSIONS_BUILD_DISPATCH`
+ * CMake option. The library holds a version of each kernel for every
+ * instruction set its compiler can target, e.g. AVX2 and AVX-512 alongside
+ * the SSE2 baseline on x86-64, or SVE alongside NEON on AArch64. The first
+ * call queries the processor once and caches the best supported version
+ * behind a pointer, so a binary built for a portable baseline still uses the
+ * widest vectors of the machine it runs on.
+ *
+ * Linking against the library defines `DIMENSIONS_DISPATCH` for consumers,
+ * and the single-type `float` and `double` kernels of `Kernels.hpp`, through
+ * which the batch conversions of every unit system are performed, then
+ * forward to these kernels.
+ */
+
+namespace Dimensions::Dispatch {
+
+/** @brief The instruction sets for which dispatched kernels may be built. */
+enum class Target {
+  Baseline,
+  Avx2,
+  Avx512,
+  Sve
+};
+
+/** @brief True for the numeric types with dispatched kernels. */
+template <typename Real>
+inline constexpr bool Dispatched =
+    std::same_as<Real, float> || std::same_as<Real, double>;
+
+/** @brief The name under which a target is reported. */
+constexpr std::string_view TargetName(Target target) noexcept {
+  switch (target) {
+    case Target::Baseline:
+      return "Baseline";
+    case Target::Avx2:
+      return "AVX2";
+    case Target::Avx512:
+      return "AVX-512";
+    case Target::Sve:
+      return "SVE";
+  }
+  return "Unknown";
+}
+
+/**
+ * @brief Returns true if kernels for `target` were built into the library
+ * and the host processor supports them.
+ */
+bool Supported(Target target) noexcept;
+
+/**
+ * @brief Returns the target whose kernels are in use, selecting the best
+ * supported target on the first call.
+ */
+Target ActiveTarget() noexcept;
+
+/**
+ * @brief Replaces the kernels in use by those for `target`, e.g. to compare
+ * targets in tests or benchmarks.
+ * @return False, with the kernels unchanged, if `target` is not supported.
+ */
+bool Select(Target target) noexcept;
+
+/** @name Dispatched Kernels
+ * @brief Equivalent to the single-type `Kernels::Multiply` overloads,
+ * including those with double-word factors. The x86-64 baseline has no
+ * fused multiply-add instructions, so the latter gain most from dispatch.
+ * @{
+ */
+void Multiply(std::span<float> values, float factor) noexcept;
+void Multiply(std::span<double> values, double factor) noexcept;
+void Multiply(std::span<const float> in, std::span<float> out,
+              float factor) noexcept;
+void Multiply(std::span<const double> in, std::span<double> out,
+              double factor) noexcept;
+void Multiply(std::span<float> values, DoubleWord<float> factor) noexcept;
+void Multiply(std::span<double> values, DoubleWord<double> factor) noexcept;
+void Multiply(std::span<const float> in, std::span<float> out,
+              DoubleWord<float> factor) noexcept;
+void Multiply(std::span<const double> in, std::span<double> out,
+              DoubleWord<double> factor) noexcept;
+/** @} */
+
+}  // namespace Dimensions::Dispatch
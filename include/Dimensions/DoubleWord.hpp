@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "Dimensions/Portability.hpp"
+
+/**
+ * @file DoubleWord.hpp
+ * @brief Double-word arithmetic for evaluating scales to twice the precision
+ * of a floating-point type.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A `DoubleWord<Real>` represents a value as the unevaluated sum of
+ * two `Real`s, a leading part and a trailing correction smaller than half an
+ * ulp of the leading part. The operations follow the error-free
+ * transformations of Knuth, Dekker and Møller, in the formulations analysed
+ * by Joldes, Muller and Popescu (2017), and have relative errors of a few
+ * units of `Real` precision squared. A product of base scales formed in this
+ * type therefore rounds to `Real` as the exact product does, except when the
+ * exact product lies within a few units of Real precision squared of a
+ * rounding boundary.
+ *
+ * Products use `std::fma` at run time and Dekker's splitting in constant
+ * expressions, which give the same bits unless a partial product overflows.
+ * Here u is the unit roundoff of `Real`.
+ */
+
+namespace Dimensions {
+
+namespace Detail {
+
+/**
+ * @brief Returns `a + b` and its rounding error.
+ */
+template <std::floating_point Real>
+DIMENSIONS_HOST_DEVICE constexpr void TwoSum(Real a, Real b, Real& sum,
+                                             Real& error) noexcept {
+  sum = a + b;
+  const auto b1 = sum - a;
+  error = (a - (sum - b1)) + (b - b1);
+}
+
+/**
+ * @brief Returns `a + b` and its rounding error, given that the exponent of
+ * `a` is no smaller than that of `b`.
+ */
+template <std::floating_point Real>
+DIMENSIONS_HOST_DEVICE constexpr void FastTwoSum(Real a, Real b, Real& sum,
+                                                 Real& error) noexcept {
+  sum = a + b;
+  error = b - (sum - a);
+}
+
+/**
+ * @brief Splits `a` into two halves whose products are exact, following
+ * Veltkamp.
+ */
+template <std::floating_point Real>
+constexpr void Split(Real a, Real& high, Real& low) noexcept {
+  constexpr auto digits = std::numeric_limits<Real>::digits;
+  constexpr auto factor =
+      static_cast<Real>(1ULL << ((digits + 1) / 2)) + static_cast<Real>(1);
+  const auto c = factor * a;
+  high = c - (c - a);
+  low = a - high;
+}
+
+/**
+ * @brief Returns `a * b` and its rounding error.
+ */
+template <std::floating_point Real>
+DIMENSIONS_HOST_DEVICE constexpr void TwoProduct(Real a, Real b, Real& product,
+                                                 Real& error) noexcept {
+  product = a * b;
+  if (std::is_constant_evaluated()) {
+    Real ah{}, al{}, bh{}, bl{};
+    Split(a, ah, al);
+    Split(b, bh, bl);
+    error = ((ah * bh - product) + ah * bl + al * bh) + al * bl;
+  } else {
+    error = std::fma(a, b, -product);
+  }
+}
+
+}  // namespace Detail
+
+/**
+ * @brief A floating-point value held as the unevaluated sum of two `Real`s.
+ *
+ * @details The type supports the operations used to accumulate scales:
+ * addition, subtraction, multiplication, division and comparison. It
+ * converts implicitly from `Real`, explicitly from other arithmetic types,
+ * and explicitly to `Real` by rounding to the nearest value.
+ *
+ * @tparam Real The floating-point type of the two parts.
+ */
+template <std::floating_point Real>
+class DoubleWord {
+ public:
+  using ValueType = Real;
+
+  /** @brief Constructs zero. */
+  constexpr DoubleWord() noexcept = default;
+
+  /** @brief Constructs the value `value` exactly. */
+  DIMENSIONS_HOST_DEVICE constexpr DoubleWord(Real value) noexcept
+      : hi_{value} {}
+
+  /**
+   * @brief Constructs the nearest double-word value to a floating-point value
+   * of another type, e.g. a `long double` constant.
+   */
+  template <std::floating_point Other>
+    requires(!std::is_same_v<Other, Real>)
+  DIMENSIONS_HOST_DEVICE explicit constexpr DoubleWord(Other value) noexcept
+      : hi_{static_cast<Real>(value)},
+        lo_{static_cast<Real>(value - static_cast<Other>(hi_))} {}
+
+  /** @brief Constructs an integer value, which is exact for small values. */
+  template <std::integral Integer>
+  DIMENSIONS_HOST_DEVICE explicit constexpr DoubleWord(Integer value) noexcept
+      : hi_{static_cast<Real>(value)} {}
+
+  /**
+   * @brief Constructs a value from its parts without normalisation.
+   * @details `lo` must be no larger than half an ulp of `hi`.
+   */
+  DIMENSIONS_HOST_DEVICE static constexpr DoubleWord FromParts(
+      Real hi, Real lo) noexcept {
+    auto value = DoubleWord(hi);
+    value.lo_ = lo;
+    return value;
+  }
+
+  /** @brief Returns the leading part, which is the value rounded to `Real`. */
+  DIMENSIONS_HOST_DEVICE constexpr Real High() const noexcept { return hi_; }
+
+  /** @brief Returns the trailing correction. */
+  DIMENSIONS_HOST_DEVICE constexpr Real Low() const noexcept { return lo_; }
+
+  /** @brief Returns the value rounded to `Real`. */
+  DIMENSIONS_HOST_DEVICE explicit constexpr operator Real() const noexcept {
+    return hi_;
+  }
+
+  DIMENSIONS_HOST_DEVICE constexpr DoubleWord operator-() const noexcept {
+    return FromParts(-hi_, -lo_);
+  }
+
+  /** @brief Returns `x + y` with a relative error of about 3u². */
+  DIMENSIONS_HOST_DEVICE friend constexpr DoubleWord operator+(
+      const DoubleWord& x, const DoubleWord& y) noexcept {
+    Real sh{}, sl{}, th{}, tl{}, vh{}, vl{}, zh{}, zl{};
+    Detail::TwoSum(x.hi_, y.hi_, sh, sl);
+    Detail::TwoSum(x.lo_, y.lo_, th, tl);
+    Detail::FastTwoSum(sh, sl + th, vh, vl);
+    Detail::FastTwoSum(vh, tl + vl, zh, zl);
+    return FromParts(zh, zl);
+  }
+
+  DIMENSIONS_HOST_DEVICE friend constexpr DoubleWord operator-(
+      const DoubleWord& x, const DoubleWord& y) noexcept {
+    return x + -y;
+  }
+
+  /** @brief Returns `x * y` with a relative error of at most 7u². */
+  DIMENSIONS_HOST_DEVICE friend constexpr DoubleWord operator*(
+      const DoubleWord& x, const DoubleWord& y) noexcept {
+    Real ch{}, cl{}, zh{}, zl{};
+    Detail::TwoProduct(x.hi_, y.hi_, ch, cl);
+    const auto cross = x.hi_ * y.lo_ + x.lo_ * y.hi_;
+    Detail::FastTwoSum(ch, cl + cross, zh, zl);
+    return FromParts(zh, zl);
+  }
+
+  /**
+   * @brief Returns `x / y`, formed from a leading quotient and two
+   * corrections computed from double-word remainders.
+   */
+  DIMENSIONS_HOST_DEVICE friend constexpr DoubleWord operator/(
+      const DoubleWord& x, const DoubleWord& y) noexcept {
+    const auto q1 = x.hi_ / y.hi_;
+    const auto remainder = x - y * DoubleWord(q1);
+    const auto q2 = remainder.hi_ / y.hi_;
+    const auto r2 = remainder - y * DoubleWord(q2);
+    const auto q3 = r2.hi_ / y.hi_;
+    Real zh{}, zl{};
+    Detail::FastTwoSum(q1, q2, zh, zl);
+    return DoubleWord::FromParts(zh, zl) + DoubleWord(q3);
+  }
+
+  constexpr DoubleWord& operator+=(const DoubleWord& y) noexcept {
+    return *this = *this + y;
+  }
+  constexpr DoubleWord& operator-=(const DoubleWord& y) noexcept {
+    return *this = *this - y;
+  }
+  constexpr DoubleWord& operator*=(const DoubleWord& y) noexcept {
+    return *this = *this * y;
+  }
+  constexpr DoubleWord& operator/=(const DoubleWord& y) noexcept {
+    return *this = *this / y;
+  }
+
+  /**
+   * @brief Compares normalised values, for which the leading parts decide
+   * unless they are equal.
+   */
+  friend constexpr auto operator<=>(const DoubleWord&,
+                                    const DoubleWord&) noexcept = default;
+  friend constexpr bool operator==(const DoubleWord&,
+                                   const DoubleWord&) noexcept = default;
+
+ private:
+  Real hi_{};
+  Real lo_{};
+};
+
+}  // namespace Dimensions
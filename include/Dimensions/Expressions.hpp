@@ -0,0 +1,442 @@
+#pragma once
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "Dimensions/Quantity.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Expressions.hpp
+ * @brief Lazy arithmetic on fields whose dimensions are tracked at compile
+ * time.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details Arithmetic on fields builds an expression object rather than a
+ * temporary array. The dimension of every subexpression is computed from
+ * those of its operands as for `Quantity`, and nothing is evaluated until the
+ * expression is assigned to an output. Redimensionalising applies the scale of
+ * the result's dimension in the same loop, so a derived field is assembled
+ * and converted in one pass over memory:
+ *
+ * \code{.cpp}
+ * using namespace Dimensions::Expressions;
+ * const auto energy = Field<Density>(rho) * Field<Velocity>(v) *
+ *                     Field<Velocity>(v) / 2;
+ * Redimensionalise(system, energy, out);  // Applies Scale<Traction>().
+ * \endcode
+ *
+ * Fields are either nondimensional arrays, tagged with a dimension by
+ * `Field<Dim>`, or arrays of `Quantity`, whose dimension is taken from the
+ * element type. The two forms cannot be mixed within an expression, only
+ * nondimensional expressions can be redimensionalised, and only dimensional
+ * ones nondimensionalised, so that a value is never scaled twice or combined
+ * with one in other units. The operands of an expression only refer to the
+ * data, which must outlive it.
+ */
+
+namespace Dimensions::Expressions {
+
+/**
+ * @brief Whether the values of an expression are nondimensional or in SI
+ * units.
+ * @details Constants are dimensionless numbers and combine with either form.
+ */
+enum class ValueForm { Nondimensional, Dimensional, Constant };
+
+/**
+ * @brief An expression whose elements can be evaluated one at a time or, when
+ * `DIMENSIONS_HAS_SIMD` is set, a vector at a time.
+ */
+template <typename E>
+concept Expression = requires(const E& e, std::size_t i) {
+  typename E::DimensionType;
+  typename E::ValueType;
+  { E::IsConstant } -> std::convertible_to<bool>;
+  { E::Form } -> std::convertible_to<ValueForm>;
+  { e.template Evaluate<typename E::ValueType>(i) };
+};
+
+/**
+ * @brief A field of nondimensional values of a given dimension.
+ * @tparam Dim The physical dimension of the values.
+ * @tparam Real The numeric type of the values.
+ */
+template <PhysicalDimension Dim, NumericConcepts::Real Real>
+class FieldExpression {
+ public:
+  using DimensionType = Dim;
+  using ValueType = Real;
+  static constexpr bool IsConstant = false;
+  static constexpr ValueForm Form = ValueForm::Nondimensional;
+
+  explicit constexpr FieldExpression(std::span<const Real> values) noexcept
+      : values_{values} {}
+
+  constexpr std::size_t size() const noexcept { return values_.size(); }
+
+  template <typename V>
+  V Evaluate(std::size_t i) const noexcept {
+#if DIMENSIONS_HAS_SIMD
+    if constexpr (!std::is_same_v<V, Real>) {
+      return V(values_.data() + i, Kernels::Detail::stdx::element_aligned);
+    } else {
+      return values_[i];
+    }
+#else
+    return values_[i];
+#endif
+  }
+
+ private:
+  std::span<const Real> values_;
+};
+
+/**
+ * @brief A field of dimensional values held as `Quantity` objects.
+ * @tparam Dim The physical dimension of the values.
+ * @tparam Real The numeric type of the values.
+ */
+template <PhysicalDimension Dim, NumericConcepts::Real Real>
+class QuantityFieldExpression {
+ public:
+  using DimensionType = Dim;
+  using ValueType = Real;
+  static constexpr bool IsConstant = false;
+  static constexpr ValueForm Form = ValueForm::Dimensional;
+
+  explicit constexpr QuantityFieldExpression(
+      std::span<const Quantity<Dim, Real>> values) noexcept
+      : values_{values} {}
+
+  constexpr std::size_t size() const noexcept { return values_.size(); }
+
+  template <typename V>
+  V Evaluate(std::size_t i) const noexcept {
+#if DIMENSIONS_HAS_SIMD
+    if constexpr (!std::is_same_v<V, Real>) {
+      return V([&](auto j) { return values_[i + j].Value(); });
+    } else {
+      return values_[i].Value();
+    }
+#else
+    return values_[i].Value();
+#endif
+  }
+
+ private:
+  std::span<const Quantity<Dim, Real>> values_;
+};
+
+/**
+ * @brief A dimensionless constant broadcast to every element.
+ * @tparam Real The numeric type of the constant.
+ */
+template <NumericConcepts::Real Real>
+class ConstantExpression {
+ public:
+  using DimensionType = Dimensionless;
+  using ValueType = Real;
+  static constexpr bool IsConstant = true;
+  static constexpr ValueForm Form = ValueForm::Constant;
+
+  explicit constexpr ConstantExpression(Real value) noexcept
+      : value_{value} {}
+
+  template <typename V>
+  V Evaluate(std::size_t) const noexcept {
+    return V(value_);
+  }
+
+ private:
+  Real value_;
+};
+
+/** @brief The negation of an expression. */
+template <Expression E>
+class NegateExpression {
+ public:
+  using DimensionType = typename E::DimensionType;
+  using ValueType = typename E::ValueType;
+  static constexpr bool IsConstant = E::IsConstant;
+  static constexpr ValueForm Form = E::Form;
+
+  explicit constexpr NegateExpression(const E& operand) noexcept
+      : operand_{operand} {}
+
+  constexpr std::size_t size() const noexcept
+    requires(!IsConstant)
+  {
+    return operand_.size();
+  }
+
+  template <typename V>
+  V Evaluate(std::size_t i) const noexcept {
+    return -operand_.template Evaluate<V>(i);
+  }
+
+ private:
+  E operand_;
+};
+
+namespace Detail {
+
+/** @brief The dimension of the result of `Op` applied to `A` and `B`. */
+template <typename Op, PhysicalDimension A, PhysicalDimension B>
+struct ResultDimension : std::type_identity<A> {
+  static_assert(std::is_same_v<A, B>,
+                "Only quantities of the same dimension can be added.");
+};
+
+template <PhysicalDimension A, PhysicalDimension B>
+struct ResultDimension<std::multiplies<>, A, B>
+    : std::type_identity<DimensionProduct<A, B>> {};
+
+template <PhysicalDimension A, PhysicalDimension B>
+struct ResultDimension<std::divides<>, A, B>
+    : std::type_identity<DimensionQuotient<A, B>> {};
+
+/** @brief True if values of the forms `A` and `B` can be combined. */
+template <ValueForm A, ValueForm B>
+inline constexpr bool CompatibleForms =
+    A == B || A == ValueForm::Constant || B == ValueForm::Constant;
+
+}  // namespace Detail
+
+/**
+ * @brief Expressions that can be operands of the same operation, i.e. that
+ * are not one nondimensional and the other dimensional.
+ */
+template <typename L, typename R>
+concept CompatibleExpressions =
+    Expression<L> && Expression<R> &&
+    Detail::CompatibleForms<L::Form, R::Form>;
+
+/**
+ * @brief A binary arithmetic operation on two expressions.
+ * @tparam Op One of `std::plus<>`, `std::minus<>`, `std::multiplies<>` or
+ * `std::divides<>`.
+ */
+template <typename Op, Expression L, Expression R>
+  requires std::same_as<typename L::ValueType, typename R::ValueType>
+class BinaryExpression {
+ public:
+  using DimensionType =
+      typename Detail::ResultDimension<Op, typename L::DimensionType,
+                                       typename R::DimensionType>::type;
+  using ValueType = typename L::ValueType;
+  static constexpr bool IsConstant = L::IsConstant && R::IsConstant;
+  static constexpr ValueForm Form =
+      L::Form == ValueForm::Constant ? R::Form : L::Form;
+
+  static_assert(Detail::CompatibleForms<L::Form, R::Form>,
+                "Nondimensional and dimensional fields cannot be combined.");
+
+  constexpr BinaryExpression(const L& left, const R& right) noexcept
+      : left_{left}, right_{right} {
+    if constexpr (!L::IsConstant && !R::IsConstant) {
+      assert(left.size() == right.size());
+    }
+  }
+
+  constexpr std::size_t size() const noexcept
+    requires(!IsConstant)
+  {
+    if constexpr (L::IsConstant) {
+      return right_.size();
+    } else {
+      return left_.size();
+    }
+  }
+
+  template <typename V>
+  V Evaluate(std::size_t i) const noexcept {
+    return Op{}(left_.template Evaluate<V>(i), right_.template Evaluate<V>(i));
+  }
+
+ private:
+  L left_;
+  R right_;
+};
+
+namespace Detail {
+
+template <typename T>
+struct IsQuantity : std::false_type {};
+
+template <PhysicalDimension Dim, NumericConcepts::Real Real>
+struct IsQuantity<Quantity<Dim, Real>> : std::true_type {};
+
+}  // namespace Detail
+
+/**
+ * @brief Wraps a contiguous range of nondimensional values as a field of the
+ * dimension `Dim`.
+ * @tparam Dim The physical dimension of the values.
+ * @param values The nondimensional data.
+ */
+template <PhysicalDimension Dim, std::ranges::contiguous_range Range>
+  requires NumericConcepts::Real<std::ranges::range_value_t<Range>>
+constexpr auto Field(const Range& values) noexcept {
+  using Real = std::ranges::range_value_t<Range>;
+  return FieldExpression<Dim, Real>(std::span<const Real>(values));
+}
+
+/**
+ * @brief Wraps a contiguous range of quantities as a field of their
+ * dimension.
+ * @param values The dimensional data.
+ */
+template <std::ranges::contiguous_range Range>
+  requires Detail::IsQuantity<std::ranges::range_value_t<Range>>::value
+constexpr auto Field(const Range& values) noexcept {
+  using Value = std::ranges::range_value_t<Range>;
+  return QuantityFieldExpression<typename Value::DimensionType,
+                                 typename Value::ValueType>(
+      std::span<const Value>(values));
+}
+
+/** @name Operators
+ * @brief Arithmetic on expressions, and between expressions and dimensionless
+ * constants, which builds a new expression. Nondimensional and dimensional
+ * expressions cannot be combined.
+ * @{
+ */
+template <Expression E>
+constexpr auto operator-(const E& e) noexcept {
+  return NegateExpression<E>(e);
+}
+
+template <Expression L, Expression R>
+  requires CompatibleExpressions<L, R>
+constexpr auto operator+(const L& l, const R& r) noexcept {
+  return BinaryExpression<std::plus<>, L, R>(l, r);
+}
+
+template <Expression L, Expression R>
+  requires CompatibleExpressions<L, R>
+constexpr auto operator-(const L& l, const R& r) noexcept {
+  return BinaryExpression<std::minus<>, L, R>(l, r);
+}
+
+template <Expression L, Expression R>
+  requires CompatibleExpressions<L, R>
+constexpr auto operator*(const L& l, const R& r) noexcept {
+  return BinaryExpression<std::multiplies<>, L, R>(l, r);
+}
+
+template <Expression L, Expression R>
+  requires CompatibleExpressions<L, R>
+constexpr auto operator/(const L& l, const R& r) noexcept {
+  return BinaryExpression<std::divides<>, L, R>(l, r);
+}
+
+template <Expression E>
+constexpr auto operator*(
+    const E& e, std::type_identity_t<typename E::ValueType> c) noexcept {
+  return e * ConstantExpression<typename E::ValueType>(c);
+}
+
+template <Expression E>
+constexpr auto operator*(std::type_identity_t<typename E::ValueType> c,
+                         const E& e) noexcept {
+  return ConstantExpression<typename E::ValueType>(c) * e;
+}
+
+template <Expression E>
+constexpr auto operator/(
+    const E& e, std::type_identity_t<typename E::ValueType> c) noexcept {
+  return e / ConstantExpression<typename E::ValueType>(c);
+}
+
+template <Expression E>
+constexpr auto operator/(std::type_identity_t<typename E::ValueType> c,
+                         const E& e) noexcept {
+  return ConstantExpression<typename E::ValueType>(c) / e;
+}
+/** @} */
+
+namespace Detail {
+
+/**
+ * @brief Writes each element of `e`, multiplied by `factor`, into `out` in
+ * a single pass.
+ */
+template <Expression E>
+void Assign(const E& e, std::span<typename E::ValueType> out,
+            typename E::ValueType factor) noexcept {
+  using Real = typename E::ValueType;
+  assert(e.size() == out.size());
+  auto* dst = out.data();
+  const auto size = out.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  namespace stdx = Kernels::Detail::stdx;
+  using Simd = stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  const Simd f = factor;
+  for (; i + width <= size; i += width) {
+    const Simd y = e.template Evaluate<Simd>(i) * f;
+    y.copy_to(dst + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) dst[i] = e.template Evaluate<Real>(i) * factor;
+}
+
+}  // namespace Detail
+
+/**
+ * @brief Evaluates an expression into `out` without rescaling.
+ * @param e The expression, which must not be constant.
+ * @param out The destination, the same size as the expression.
+ */
+template <Expression E>
+  requires(!E::IsConstant)
+void Evaluate(const E& e, std::span<typename E::ValueType> out) noexcept {
+  Detail::Assign(e, out, typename E::ValueType{1});
+}
+
+/**
+ * @brief Evaluates an expression of nondimensional fields and converts the
+ * result to dimensional form in the same pass.
+ * @param system The unit system.
+ * @param e The expression, which must be nondimensional.
+ * @param out The destination, the same size as the expression.
+ */
+template <typename Derived_, typename Real, Expression E>
+  requires(E::Form == ValueForm::Nondimensional &&
+           std::same_as<typename E::ValueType, Real>)
+void Redimensionalise(const Dimensions<Derived_, Real>& system, const E& e,
+                      std::type_identity_t<std::span<Real>> out) noexcept {
+  const auto& derived = static_cast<const Derived_&>(system);
+  Detail::Assign(
+      e, out, derived.template Scale<typename E::DimensionType>());
+}
+
+/**
+ * @brief Evaluates an expression of dimensional fields and converts the
+ * result to nondimensional form in the same pass.
+ * @param system The unit system.
+ * @param e The expression, which must be dimensional.
+ * @param out The destination, the same size as the expression.
+ */
+template <typename Derived_, typename Real, Expression E>
+  requires(E::Form == ValueForm::Dimensional &&
+           std::same_as<typename E::ValueType, Real>)
+void Nondimensionalise(const Dimensions<Derived_, Real>& system, const E& e,
+                       std::type_identity_t<std::span<Real>> out) noexcept {
+  const auto& derived = static_cast<const Derived_&>(system);
+  Detail::Assign(
+      e, out, derived.template InverseScale<typename E::DimensionType>());
+}
+
+}  // namespace Dimensions::Expressions
@@ -0,0 +1,369 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Views.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DIMENSIONS_HAS_MMAP 1
+#else
+#define DIMENSIONS_HAS_MMAP 0
+#endif
+
+/**
+ * @file FieldFile.hpp
+ * @brief A self-describing binary format for nondimensional fields.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A field file holds a fixed-size `FieldHeader` followed by the raw
+ * values, starting at an offset that is a multiple of `FieldAlignment`. The
+ * header records the base scales of the unit system in which the values are
+ * nondimensional and the exponents of the quantity, so that a reader can
+ * either use the payload in place, when its own system matches, or convert
+ * it by a single fused factor as it is read:
+ *
+ * \code{.cpp}
+ * auto file = Dimensions::MappedFile("velocity.dim");
+ * auto field = Dimensions::FieldView<float>(file.Bytes());
+ * for (auto v : field.Converted(system)) { ... }
+ * \endcode
+ *
+ * All multi-byte values are stored in the byte order of the writer, which is
+ * recorded in the header; files written on a machine of different byte order
+ * are rejected. Errors in reading or writing are reported by throwing
+ * `std::runtime_error`.
+ */
+
+namespace Dimensions {
+
+/** @brief The alignment, in bytes, of the payload of a field file. */
+inline constexpr std::size_t FieldAlignment = 64;
+
+/** @brief The current version of the field file format. */
+inline constexpr std::uint32_t FieldFormatVersion = 1;
+
+/** @brief The type of the values stored in a field file. */
+enum class FieldElementType : std::uint32_t { Float32 = 1, Float64 = 2 };
+
+namespace Detail {
+
+template <typename Real>
+struct FieldElementTypeOf;
+
+template <>
+struct FieldElementTypeOf<float> {
+  static constexpr auto value = FieldElementType::Float32;
+};
+
+template <>
+struct FieldElementTypeOf<double> {
+  static constexpr auto value = FieldElementType::Float64;
+};
+
+inline constexpr std::array<char, 8> FieldMagic = {'D', 'I', 'M', 'F',
+                                                   'I', 'E', 'L', 'D'};
+inline constexpr std::uint32_t FieldByteOrderMark = 0x01020304;
+
+}  // namespace Detail
+
+/**
+ * @brief The fixed-size header at the start of a field file.
+ *
+ * @details The exponents are those of length, mass, time and temperature, as
+ * for `Dimension`. The base scales are stored in double precision whatever
+ * the type of the payload.
+ */
+struct FieldHeader {
+  std::array<char, 8> magic;
+  std::uint32_t version;
+  std::uint32_t byteOrder;
+  std::uint64_t payloadOffset;
+  std::uint64_t count;
+  SystemConstants<double> constants;
+  std::array<std::int32_t, 4> exponents;
+  FieldElementType elementType;
+  std::uint32_t elementSize;
+  std::array<std::byte, 40> reserved;
+};
+
+static_assert(sizeof(FieldHeader) == 128);
+static_assert(std::is_trivially_copyable_v<FieldHeader>);
+static_assert(sizeof(FieldHeader) % FieldAlignment == 0);
+
+/**
+ * @brief Builds the header describing a nondimensional field.
+ * @tparam Dim The physical dimension of the values.
+ * @tparam Real The type of the values.
+ * @param system The unit system in which the values are nondimensional.
+ * @param count The number of values.
+ * @return The header.
+ */
+template <PhysicalDimension Dim, NumericConcepts::Real Real, typename Derived_,
+          typename SystemReal>
+constexpr FieldHeader MakeFieldHeader(
+    const Dimensions<Derived_, SystemReal>& system,
+    std::uint64_t count) noexcept {
+  const auto& derived = static_cast<const Derived_&>(system);
+  return FieldHeader{
+      .magic = Detail::FieldMagic,
+      .version = FieldFormatVersion,
+      .byteOrder = Detail::FieldByteOrderMark,
+      .payloadOffset = sizeof(FieldHeader),
+      .count = count,
+      .constants = {.lengthScale = static_cast<double>(derived.LengthScale()),
+                    .densityScale = static_cast<double>(derived.DensityScale()),
+                    .timeScale = static_cast<double>(derived.TimeScale()),
+                    .temperatureScale =
+                        static_cast<double>(derived.TemperatureScale())},
+      .exponents = {Dim::Length, Dim::Mass, Dim::Time, Dim::Temperature},
+      .elementType = Detail::FieldElementTypeOf<Real>::value,
+      .elementSize = sizeof(Real),
+      .reserved = {}};
+}
+
+/**
+ * @brief Writes a nondimensional field, with its header, to a stream.
+ * @tparam Dim The physical dimension of the values.
+ * @param out The stream, which should be opened in binary mode.
+ * @param system The unit system in which the values are nondimensional.
+ * @param values The nondimensional values.
+ */
+template <PhysicalDimension Dim, typename Derived_, typename SystemReal,
+          NumericConcepts::Real Real>
+void WriteField(std::ostream& out,
+                const Dimensions<Derived_, SystemReal>& system,
+                std::span<const Real> values) {
+  const auto header = MakeFieldHeader<Dim, Real>(system, values.size());
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(values.data()),
+            static_cast<std::streamsize>(values.size_bytes()));
+  if (!out) throw std::runtime_error("Failed to write field.");
+}
+
+/**
+ * @brief Writes a nondimensional field of a quantity selected at runtime.
+ * @param out The stream, which should be opened in binary mode.
+ * @param system The unit system in which the values are nondimensional.
+ * @param values The nondimensional values.
+ * @param kind The physical quantity that the values represent.
+ */
+template <typename Derived_, typename SystemReal, NumericConcepts::Real Real>
+void WriteField(std::ostream& out,
+                const Dimensions<Derived_, SystemReal>& system,
+                std::span<const Real> values, QuantityKind kind) {
+  VisitDimension(kind, [&](auto dimension) {
+    WriteField<decltype(dimension)>(out, system, values);
+  });
+}
+
+/**
+ * @brief A read-only view of a field file held in memory.
+ *
+ * @details The view does not own or copy the bytes, which may come from a
+ * `MappedFile` or any other buffer that outlives it. The constructor checks
+ * the header and throws `std::runtime_error` if the bytes do not hold a
+ * complete field of type `Real`, or if the payload is not suitably aligned.
+ *
+ * @tparam Real The type of the stored values.
+ */
+template <NumericConcepts::Real Real>
+class FieldView {
+ public:
+  /**
+   * @brief Validates the header and locates the payload.
+   * @param bytes The contents of a field file.
+   */
+  explicit FieldView(std::span<const std::byte> bytes) {
+    if (bytes.size() < sizeof(FieldHeader)) {
+      throw std::runtime_error("Field file is shorter than its header.");
+    }
+    std::memcpy(&header_, bytes.data(), sizeof(FieldHeader));
+    if (header_.magic != Detail::FieldMagic) {
+      throw std::runtime_error("Not a field file.");
+    }
+    if (header_.version != FieldFormatVersion) {
+      throw std::runtime_error("Unsupported field file version " +
+                               std::to_string(header_.version) + ".");
+    }
+    if (header_.byteOrder != Detail::FieldByteOrderMark) {
+      throw std::runtime_error("Field file has a different byte order.");
+    }
+    if (header_.elementType != Detail::FieldElementTypeOf<Real>::value ||
+        header_.elementSize != sizeof(Real)) {
+      throw std::runtime_error("Field file holds a different element type.");
+    }
+    const auto offset = header_.payloadOffset;
+    if (offset < sizeof(FieldHeader) || offset > bytes.size() ||
+        header_.count > (bytes.size() - offset) / sizeof(Real)) {
+      throw std::runtime_error("Field file is truncated.");
+    }
+    const auto* payload = bytes.data() + offset;
+    if (reinterpret_cast<std::uintptr_t>(payload) % alignof(Real) != 0) {
+      throw std::runtime_error("Field payload is misaligned.");
+    }
+    values_ = std::span<const Real>(reinterpret_cast<const Real*>(payload),
+                                    static_cast<std::size_t>(header_.count));
+  }
+
+  /** @brief Returns the header of the file. */
+  const FieldHeader& Header() const noexcept { return header_; }
+
+  /** @brief Returns the base scales of the system that wrote the field. */
+  const SystemConstants<double>& Constants() const noexcept {
+    return header_.constants;
+  }
+
+  /** @brief Returns the stored nondimensional values without copying. */
+  std::span<const Real> Values() const noexcept { return values_; }
+
+  /** @brief Returns true if the field has the dimension `Dim`. */
+  template <PhysicalDimension Dim>
+  bool Holds() const noexcept {
+    return header_.exponents ==
+           std::array<std::int32_t, 4>{Dim::Length, Dim::Mass, Dim::Time,
+                                       Dim::Temperature};
+  }
+
+  /**
+   * @brief Returns the factor converting the stored values into values that
+   * are nondimensional in another system.
+   * @param to The unit system of the reader.
+   * @return The fused conversion factor, exactly one if the base scales of
+   * both systems are equal.
+   */
+  template <typename Derived_, typename SystemReal>
+  double ConversionFactor(
+      const Dimensions<Derived_, SystemReal>& to) const noexcept {
+    const auto from = Detail::RuntimeBaseScales<double>(header_.constants);
+    const auto [l, m, t, theta] = header_.exponents;
+    return static_cast<double>(::Dimensions::ConversionFactor(
+        from, static_cast<const Derived_&>(to), {l, m, t, theta}));
+  }
+
+  /**
+   * @brief Returns true if the stored values are already nondimensional in
+   * another system, so that `Values()` can be used directly.
+   * @param to The unit system of the reader.
+   */
+  template <typename Derived_, typename SystemReal>
+  bool IsNondimensionalIn(
+      const Dimensions<Derived_, SystemReal>& to) const noexcept {
+    return ConversionFactor(to) == 1.0;
+  }
+
+  /**
+   * @brief Returns a lazy view of the values converted into another system.
+   * @param to The unit system of the reader.
+   * @return A range that multiplies each stored value by the fused factor as
+   * it is read.
+   */
+  template <typename Derived_, typename SystemReal>
+  auto Converted(const Dimensions<Derived_, SystemReal>& to) const {
+    return values_ | Views::Scale(static_cast<Real>(ConversionFactor(to)));
+  }
+
+ private:
+  FieldHeader header_;
+  std::span<const Real> values_;
+};
+
+#if DIMENSIONS_HAS_MMAP
+/**
+ * @brief A read-only memory mapping of a file.
+ *
+ * @details Pages are loaded on first access, so the cost of opening a large
+ * field is bounded by the pages actually read. Mappings are aligned to the
+ * page size, which satisfies `FieldAlignment`.
+ */
+class MappedFile {
+ public:
+  /**
+   * @brief Maps the whole of a file.
+   * @param path The path of the file.
+   */
+  explicit MappedFile(const std::string& path) {
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) Fail("open", path, errno);
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0) {
+      const auto error = errno;
+      ::close(descriptor);
+      Fail("stat", path, error);
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (size_ > 0) {
+      data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (data_ == MAP_FAILED) {
+        const auto error = errno;
+        data_ = nullptr;
+        ::close(descriptor);
+        Fail("map", path, error);
+      }
+    }
+    ::close(descriptor);
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  MappedFile(MappedFile&& other) noexcept
+      : data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0)} {}
+
+  MappedFile& operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+      Unmap();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  ~MappedFile() { Unmap(); }
+
+  /** @brief Returns the contents of the file. */
+  std::span<const std::byte> Bytes() const noexcept {
+    return {static_cast<const std::byte*>(data_), size_};
+  }
+
+ private:
+  void* data_ = nullptr;
+  std::size_t size_ = 0;
+
+  void Unmap() noexcept {
+    if (data_ != nullptr) ::munmap(data_, size_);
+  }
+
+  /**
+   * @brief Throws for a failed system call.
+   * @details The error number is captured by the caller immediately after
+   * the call, since closing the descriptor may overwrite `errno`.
+   */
+  [[noreturn]] static void Fail(const char* action, const std::string& path,
+                                int error) {
+    throw std::runtime_error("Failed to " + std::string(action) + " " + path +
+                             ": " + std::strerror(error));
+  }
+};
+#endif
+
+}  // namespace Dimensions
@@ -0,0 +1,276 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "Dimensions/Dimension.hpp"
+
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+#include <atomic>
+#include <chrono>
+#endif
+
+/**
+ * @file Instrumentation.hpp
+ * @brief Optional counters of the work done by the batch conversion methods.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details When `DIMENSIONS_ENABLE_INSTRUMENTATION` is defined, every batch
+ * conversion records, for the quantity converted, the number of calls, the
+ * elements converted, the bytes read and written, and the elapsed time. Each
+ * thread updates its own counters without atomic read-modify-write
+ * operations, and `Capture` sums the counters of all threads. When the macro
+ * is not defined the instrumentation compiles to nothing and `Capture`
+ * returns zeros. The macro must be defined consistently in every translation
+ * unit of a program, which the `DIMENSIONS_ENABLE_INSTRUMENTATION` CMake
+ * option arranges.
+ *
+ * This header is included by every conversion, so it holds only the
+ * counters; `InstrumentationJson.hpp` formats snapshots as JSON.
+ */
+
+namespace Dimensions::Instrumentation {
+
+/** @brief True if the instrumentation is compiled in. */
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+inline constexpr bool Enabled = true;
+#else
+inline constexpr bool Enabled = false;
+#endif
+
+/** @brief The number of quantity kinds for which counters are kept. */
+inline constexpr std::size_t KindCount =
+    static_cast<std::size_t>(QuantityKind::Entropy) + 1;
+
+/** @brief The counter slot for a quantity kind. */
+constexpr std::size_t Slot(QuantityKind kind) noexcept {
+  return static_cast<std::size_t>(kind);
+}
+
+/**
+ * @brief The counter slot for interleaved records, whose components may be
+ * of several kinds.
+ */
+inline constexpr std::size_t InterleavedSlot = KindCount;
+
+/** @brief The totals recorded for one counter slot. */
+struct Counters {
+  std::uint64_t calls = 0;
+  std::uint64_t elements = 0;
+  std::uint64_t bytes = 0;
+  std::uint64_t nanoseconds = 0;
+
+  constexpr Counters& operator+=(const Counters& other) noexcept {
+    calls += other.calls;
+    elements += other.elements;
+    bytes += other.bytes;
+    nanoseconds += other.nanoseconds;
+    return *this;
+  }
+
+  friend constexpr bool operator==(const Counters&,
+                                   const Counters&) noexcept = default;
+};
+
+/** @brief The totals of every counter slot over all threads. */
+struct Snapshot {
+  std::array<Counters, KindCount + 1> slots{};
+
+  /** @brief Returns the totals for a quantity kind. */
+  constexpr const Counters& operator[](QuantityKind kind) const noexcept {
+    return slots[Slot(kind)];
+  }
+
+  /** @brief Returns the totals for interleaved records. */
+  constexpr const Counters& Interleaved() const noexcept {
+    return slots[InterleavedSlot];
+  }
+
+  /** @brief Returns the totals over all slots. */
+  constexpr Counters Total() const noexcept {
+    auto total = Counters{};
+    for (const auto& counters : slots) total += counters;
+    return total;
+  }
+};
+
+namespace Detail {
+
+/** @brief The name under which a slot is reported. */
+constexpr std::string_view SlotName(std::size_t slot) noexcept {
+  constexpr std::array<std::string_view, KindCount + 1> names = {
+      "Length", "Density", "Time", "Temperature", "Mass", "Velocity",
+      "Acceleration", "Force", "Traction", "Moment", "Potential", "Energy",
+      "HeatFlux", "ThermalConductivity", "SpecificHeat", "Entropy",
+      "Interleaved"};
+  return names[slot];
+}
+
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+/**
+ * @brief One counter that is written by a single thread and may be read by
+ * any.
+ */
+struct LocalCounter {
+  std::atomic<std::uint64_t> value{0};
+
+  void Add(std::uint64_t amount) noexcept {
+    value.store(value.load(std::memory_order_relaxed) + amount,
+                std::memory_order_relaxed);
+  }
+};
+
+struct LocalCounters {
+  LocalCounter calls;
+  LocalCounter elements;
+  LocalCounter bytes;
+  LocalCounter nanoseconds;
+};
+
+/**
+ * @brief The counters of one thread, linked into a registry that is only
+ * ever prepended to.
+ *
+ * @details Records are never freed, so that the work done by threads that
+ * have exited is still included in snapshots.
+ */
+struct alignas(64) ThreadRecord {
+  std::array<LocalCounters, KindCount + 1> slots;
+  ThreadRecord* next = nullptr;
+};
+
+inline std::atomic<ThreadRecord*> Registry{nullptr};
+
+/** @brief Returns the record of the calling thread, creating it if needed. */
+inline ThreadRecord& LocalRecord() {
+  thread_local ThreadRecord* record = [] {
+    auto* created = new ThreadRecord();
+    created->next = Registry.load(std::memory_order_relaxed);
+    while (!Registry.compare_exchange_weak(created->next, created,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    return created;
+  }();
+  return *record;
+}
+#endif
+
+}  // namespace Detail
+
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+/**
+ * @brief Records one conversion in the counters of the calling thread when
+ * it goes out of scope.
+ */
+class ScopedConversion {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /**
+   * @param slot The counter slot.
+   * @param elements The number of elements converted.
+   * @param bytes The number of bytes read and written.
+   */
+  ScopedConversion(std::size_t slot, std::size_t elements,
+                   std::size_t bytes) noexcept
+      : slot_{slot}, elements_{elements}, bytes_{bytes}, start_{Clock::now()} {}
+
+  ScopedConversion(const ScopedConversion&) = delete;
+  ScopedConversion& operator=(const ScopedConversion&) = delete;
+
+  ~ScopedConversion() {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now() - start_);
+    auto& counters = Detail::LocalRecord().slots[slot_];
+    counters.calls.Add(1);
+    counters.elements.Add(elements_);
+    counters.bytes.Add(bytes_);
+    counters.nanoseconds.Add(static_cast<std::uint64_t>(elapsed.count()));
+  }
+
+ private:
+  std::size_t slot_;
+  std::size_t elements_;
+  std::size_t bytes_;
+  Clock::time_point start_;
+};
+#endif
+
+/**
+ * @brief Returns the totals of every counter over all threads.
+ *
+ * @details Counters are read without stopping other threads, so a snapshot
+ * taken during conversions may include some of them only in part.
+ */
+inline Snapshot Capture() noexcept {
+  auto snapshot = Snapshot{};
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+  constexpr auto order = std::memory_order_relaxed;
+  for (auto* record = Detail::Registry.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    for (std::size_t i = 0; i < snapshot.slots.size(); ++i) {
+      const auto& counters = record->slots[i];
+      snapshot.slots[i] += {.calls = counters.calls.value.load(order),
+                            .elements = counters.elements.value.load(order),
+                            .bytes = counters.bytes.value.load(order),
+                            .nanoseconds =
+                                counters.nanoseconds.value.load(order)};
+    }
+  }
+#endif
+  return snapshot;
+}
+
+/**
+ * @brief Sets every counter of every thread to zero.
+ *
+ * @details This should be called while no conversions are in progress, as an
+ * update made concurrently may be lost or may survive the reset.
+ */
+inline void Reset() noexcept {
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+  constexpr auto order = std::memory_order_relaxed;
+  for (auto* record = Detail::Registry.load(std::memory_order_acquire);
+       record != nullptr; record = record->next) {
+    for (auto& counters : record->slots) {
+      counters.calls.value.store(0, order);
+      counters.elements.value.store(0, order);
+      counters.bytes.value.store(0, order);
+      counters.nanoseconds.value.store(0, order);
+    }
+  }
+#endif
+}
+
+/**
+ * @brief Calls `f(name, counters)` for every slot with at least one call.
+ * @param snapshot The snapshot to visit.
+ * @param f A callable accepting a `std::string_view` and a `Counters`.
+ */
+template <typename F>
+void Visit(const Snapshot& snapshot, F&& f) {
+  for (std::size_t i = 0; i < snapshot.slots.size(); ++i) {
+    if (snapshot.slots[i].calls != 0) {
+      f(Detail::SlotName(i), snapshot.slots[i]);
+    }
+  }
+}
+
+}  // namespace Dimensions::Instrumentation
+
+/**
+ * @brief Records the enclosing scope as one conversion, or does nothing if
+ * the instrumentation is disabled.
+ */
+#if defined(DIMENSIONS_ENABLE_INSTRUMENTATION)
+#define DIMENSIONS_INSTRUMENT_CONVERSION(slot, elements, bytes)             \
+  const ::Dimensions::Instrumentation::ScopedConversion                     \
+      dimensionsScopedConversion_(slot, elements, bytes)
+#else
+#define DIMENSIONS_INSTRUMENT_CONVERSION(slot, elements, bytes) \
+  static_cast<void>(0)
+#endif
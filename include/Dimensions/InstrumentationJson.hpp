@@ -0,0 +1,56 @@
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "Dimensions/Instrumentation.hpp"
+
+/**
+ * @file InstrumentationJson.hpp
+ * @brief JSON output of instrumentation snapshots.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details These functions are kept apart from `Instrumentation.hpp` so that
+ * the conversion headers do not pull in the stream library.
+ *
+ * \code{.cpp}
+ * Dimensions::Instrumentation::WriteJson(
+ *     std::cout, Dimensions::Instrumentation::Capture());
+ * \endcode
+ */
+
+namespace Dimensions::Instrumentation {
+
+/**
+ * @brief Writes a snapshot as a JSON object keyed by quantity, omitting
+ * slots with no calls.
+ * @param out The destination stream.
+ * @param snapshot The snapshot to write.
+ */
+inline void WriteJson(std::ostream& out, const Snapshot& snapshot) {
+  out << '{';
+  auto first = true;
+  Visit(snapshot, [&](std::string_view name, const Counters& counters) {
+    out << (first ? "" : ",") << '"' << name << "\":{\"calls\":"
+        << counters.calls << ",\"elements\":" << counters.elements
+        << ",\"bytes\":" << counters.bytes
+        << ",\"nanoseconds\":" << counters.nanoseconds << '}';
+    first = false;
+  });
+  out << '}';
+}
+
+/**
+ * @brief Returns a snapshot as a JSON string.
+ * @param snapshot The snapshot to format.
+ */
+inline std::string ToJson(const Snapshot& snapshot) {
+  auto out = std::ostringstream();
+  WriteJson(out, snapshot);
+  return out.str();
+}
+
+}  // namespace Dimensions::Instrumentation
@@ -0,0 +1,685 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <version>
+
+#include "Dimensions/DoubleWord.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+#if defined(__cpp_lib_mdspan) && __has_include(<mdspan>)
+#include <mdspan>
+#define DIMENSIONS_HAS_MDSPAN 1
+#else
+#define DIMENSIONS_HAS_MDSPAN 0
+#endif
+
+// Explicit SIMD is not used in CUDA or HIP translation units, whose device
+// compilation passes cannot parse the host vector extensions.
+#if !defined(DIMENSIONS_DISABLE_SIMD) && !defined(__CUDACC__) && \
+    !defined(__HIPCC__) && __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define DIMENSIONS_HAS_SIMD 1
+#else
+#define DIMENSIONS_HAS_SIMD 0
+#endif
+
+#if defined(DIMENSIONS_DISPATCH)
+#include "Dimensions/Dispatch.hpp"
+#endif
+
+#if defined(__FLT16_MAX__)
+#define DIMENSIONS_HAS_FLOAT16 1
+#else
+#define DIMENSIONS_HAS_FLOAT16 0
+#endif
+
+/**
+ * @file Kernels.hpp
+ * @brief Vectorised kernels for applying scaling factors to contiguous data.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details When `<experimental/simd>` is available the kernels are written
+ * with explicit SIMD types for the native vector width of the target, with a
+ * scalar loop to peel off elements until the output is suitably aligned.
+ * Otherwise, or if `DIMENSIONS_DISABLE_SIMD` is defined, a plain loop is used
+ * and vectorisation is left to the compiler.
+ *
+ * Mixed-precision kernels read and write storage types, including
+ * `_Float16` where the compiler supports it, that differ from the type in
+ * which the factor is applied, fusing the conversions with the scaling.
+ *
+ * When the program links against the `Dimensions::Dispatch` library, which
+ * defines `DIMENSIONS_DISPATCH`, the single-type `float` and `double` kernels,
+ * including those with double-word factors, instead call the versions
+ * selected at runtime for the host processor, as described in
+ * `Dispatch.hpp`.
+ *
+ * Fields of complex numbers or of small fixed-size tensors, whose elements
+ * are all of the same quantity, are scaled as packed arrays of their real
+ * components, so that real and imaginary parts share full-width vectors.
+ *
+ * Multi-component fields, in which each record holds several quantities with
+ * different scales, are handled in a single pass. Where the standard library
+ * provides `std::mdspan`, kernels accepting rank-one and rank-two `mdspan`s
+ * with arbitrary layouts are also defined. These are experimental: they are
+ * only compiled, and tested, with a standard library that has `<mdspan>`.
+ */
+
+namespace Dimensions::Kernels {
+
+namespace Detail {
+
+#if DIMENSIONS_HAS_SIMD
+namespace stdx = std::experimental;
+
+/**
+ * @brief Returns the number of leading elements that must be processed before
+ * `data` is aligned for vector loads and stores.
+ */
+template <typename Real>
+std::size_t PeelCount(const Real* data, std::size_t size) noexcept {
+  constexpr auto alignment = stdx::memory_alignment_v<stdx::native_simd<Real>>;
+  const auto address = reinterpret_cast<std::uintptr_t>(data);
+  const auto offset = address % alignment;
+  if (offset == 0) return 0;
+  if (offset % sizeof(Real) != 0) return size;
+  const auto peel = (alignment - offset) / sizeof(Real);
+  return peel < size ? peel : size;
+}
+#endif
+
+}  // namespace Detail
+
+/**
+ * @brief Multiplies every element of `values` in place by `factor`.
+ * @tparam Real The numeric type of the data.
+ * @param values The data to be scaled.
+ * @param factor The scaling factor.
+ */
+template <NumericConcepts::Real Real>
+void Multiply(std::span<Real> values, Real factor) noexcept {
+#if defined(DIMENSIONS_DISPATCH)
+  if constexpr (Dispatch::Dispatched<Real>) {
+    Dispatch::Multiply(values, factor);
+    return;
+  }
+#endif
+  auto* data = values.data();
+  const auto size = values.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  using Simd = Detail::stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  for (const auto peel = Detail::PeelCount(data, size); i < peel; ++i) {
+    data[i] *= factor;
+  }
+  const Simd f = factor;
+  for (; i + 2 * width <= size; i += 2 * width) {
+    Simd a(data + i, Detail::stdx::vector_aligned);
+    Simd b(data + i + width, Detail::stdx::vector_aligned);
+    (a * f).copy_to(data + i, Detail::stdx::vector_aligned);
+    (b * f).copy_to(data + i + width, Detail::stdx::vector_aligned);
+  }
+  for (; i + width <= size; i += width) {
+    Simd a(data + i, Detail::stdx::vector_aligned);
+    (a * f).copy_to(data + i, Detail::stdx::vector_aligned);
+  }
+#endif
+  for (; i < size; ++i) data[i] *= factor;
+}
+
+/**
+ * @brief Multiplies every element of `values` in place by a compile-time
+ * factor.
+ * @details When the factor is one the call does nothing.
+ * @tparam Factor The scaling factor.
+ * @tparam Real The numeric type of the data.
+ * @param values The data to be scaled.
+ */
+template <auto Factor, NumericConcepts::Real Real>
+void Multiply(std::span<Real> values) noexcept {
+  if constexpr (Factor != 1) Multiply(values, static_cast<Real>(Factor));
+}
+
+/**
+ * @brief Writes each element of `in` multiplied by `factor` into `out`.
+ * @tparam Real The numeric type of the data.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factor The scaling factor.
+ */
+template <NumericConcepts::Real Real>
+void Multiply(std::span<const Real> in, std::span<Real> out,
+              Real factor) noexcept {
+  assert(in.size() == out.size());
+#if defined(DIMENSIONS_DISPATCH)
+  if constexpr (Dispatch::Dispatched<Real>) {
+    Dispatch::Multiply(in, out, factor);
+    return;
+  }
+#endif
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  // Alignment is chosen for the output so that stores never split a cache
+  // line; the input is then read with unaligned loads.
+  using Simd = Detail::stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  for (const auto peel = Detail::PeelCount(dst, size); i < peel; ++i) {
+    dst[i] = src[i] * factor;
+  }
+  const Simd f = factor;
+  for (; i + 2 * width <= size; i += 2 * width) {
+    Simd a(src + i, Detail::stdx::element_aligned);
+    Simd b(src + i + width, Detail::stdx::element_aligned);
+    (a * f).copy_to(dst + i, Detail::stdx::vector_aligned);
+    (b * f).copy_to(dst + i + width, Detail::stdx::vector_aligned);
+  }
+  for (; i + width <= size; i += width) {
+    Simd a(src + i, Detail::stdx::element_aligned);
+    (a * f).copy_to(dst + i, Detail::stdx::vector_aligned);
+  }
+#endif
+  for (; i < size; ++i) dst[i] = src[i] * factor;
+}
+
+/**
+ * @brief Writes each element of `in` multiplied by a compile-time factor into
+ * `out`.
+ * @details When the factor is one the data is copied without multiplying.
+ * @tparam Factor The scaling factor.
+ * @tparam Real The numeric type of the data.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ */
+template <auto Factor, NumericConcepts::Real Real>
+void Multiply(std::span<const Real> in, std::span<Real> out) noexcept {
+  assert(in.size() == out.size());
+  if constexpr (Factor == 1) {
+    std::copy(in.begin(), in.end(), out.begin());
+  } else {
+    Multiply(in, out, static_cast<Real>(Factor));
+  }
+}
+
+/**
+ * @brief Multiplies every element of `values` in place by a double-word
+ * factor.
+ *
+ * @details Each element is formed as `fma(x, hi, x * lo)`, whose single
+ * rounding is applied to `x * hi` plus a correction, so the result is the
+ * correctly rounded product of `x` and the factor except in rare cases very
+ * close to a rounding boundary. The result does not depend on the vector
+ * width or on the platform. Unless fused multiply-add instructions are
+ * enabled at compile time, e.g. by `-mfma`, or the dispatched kernels of
+ * `Dispatch.hpp` are linked, `std::fma` is evaluated by a library call,
+ * which is much slower.
+ *
+ * @tparam Real The numeric type of the data.
+ * @param values The data to be scaled.
+ * @param factor The scaling factor.
+ */
+template <std::floating_point Real>
+void Multiply(std::span<Real> values, DoubleWord<Real> factor) noexcept {
+#if defined(DIMENSIONS_DISPATCH)
+  if constexpr (Dispatch::Dispatched<Real>) {
+    Dispatch::Multiply(values, factor);
+    return;
+  }
+#endif
+  const auto hi = factor.High();
+  const auto lo = factor.Low();
+  auto* data = values.data();
+  const auto size = values.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  using Simd = Detail::stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  for (const auto peel = Detail::PeelCount(data, size); i < peel; ++i) {
+    data[i] = std::fma(data[i], hi, data[i] * lo);
+  }
+  const Simd h = hi;
+  const Simd l = lo;
+  for (; i + width <= size; i += width) {
+    Simd a(data + i, Detail::stdx::vector_aligned);
+    Detail::stdx::fma(a, h, a * l).copy_to(data + i,
+                                           Detail::stdx::vector_aligned);
+  }
+#endif
+  for (; i < size; ++i) data[i] = std::fma(data[i], hi, data[i] * lo);
+}
+
+/**
+ * @brief Writes each element of `in` multiplied by a double-word factor into
+ * `out`, as the in-place overload does.
+ * @tparam Real The numeric type of the data.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factor The scaling factor.
+ */
+template <std::floating_point Real>
+void Multiply(std::type_identity_t<std::span<const Real>> in,
+              std::span<Real> out, DoubleWord<Real> factor) noexcept {
+  assert(in.size() == out.size());
+#if defined(DIMENSIONS_DISPATCH)
+  if constexpr (Dispatch::Dispatched<Real>) {
+    Dispatch::Multiply(in, out, factor);
+    return;
+  }
+#endif
+  const auto hi = factor.High();
+  const auto lo = factor.Low();
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  using Simd = Detail::stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  for (const auto peel = Detail::PeelCount(dst, size); i < peel; ++i) {
+    dst[i] = std::fma(src[i], hi, src[i] * lo);
+  }
+  const Simd h = hi;
+  const Simd l = lo;
+  for (; i + width <= size; i += width) {
+    Simd a(src + i, Detail::stdx::element_aligned);
+    Detail::stdx::fma(a, h, a * l).copy_to(dst + i,
+                                           Detail::stdx::vector_aligned);
+  }
+#endif
+  for (; i < size; ++i) dst[i] = std::fma(src[i], hi, src[i] * lo);
+}
+
+namespace Detail {
+
+/**
+ * @brief True for the half-precision storage type, where supported.
+ */
+template <typename T>
+inline constexpr bool IsHalf = false;
+
+#if DIMENSIONS_HAS_FLOAT16
+template <>
+inline constexpr bool IsHalf<_Float16> = true;
+#endif
+
+}  // namespace Detail
+
+/**
+ * @brief Concept satisfied by the floating-point types in which a field may
+ * be stored.
+ *
+ * @details This extends `NumericConcepts::Real` with `_Float16`, which can be
+ * used for storage but is never used for arithmetic by the library.
+ */
+template <typename T>
+concept StorageReal = NumericConcepts::Real<T> || Detail::IsHalf<T>;
+
+/**
+ * @brief Writes each element of `in` multiplied by `factor` into `out`,
+ * converting between storage types in the same pass.
+ *
+ * @details Each element is widened to the type of the factor, multiplied, and
+ * rounded once to the output type, so that a `double` factor can be applied
+ * to `float` or `_Float16` data without a separate cast loop or temporary.
+ * When all three types are the same the single-type overload of
+ * `Multiply` is used instead.
+ *
+ * @tparam In The storage type of the input.
+ * @tparam Out The storage type of the output.
+ * @tparam Factor The type in which the factor is applied.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factor The scaling factor.
+ */
+template <StorageReal In, StorageReal Out, NumericConcepts::Real Factor>
+  requires(!std::is_same_v<In, Out> || !std::is_same_v<In, Factor>)
+void Multiply(std::span<const In> in, std::span<Out> out,
+              Factor factor) noexcept {
+  assert(in.size() == out.size());
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  if constexpr (!Detail::IsHalf<In> && !Detail::IsHalf<Out>) {
+    // The vector width is that of the arithmetic type, and the narrower
+    // storage type is loaded and stored with the same number of lanes.
+    namespace stdx = Detail::stdx;
+    constexpr auto width = stdx::native_simd<Factor>::size();
+    using Source = stdx::fixed_size_simd<In, width>;
+    const stdx::fixed_size_simd<Factor, width> f = factor;
+    for (; i + width <= size; i += width) {
+      const auto a = Source(src + i, stdx::element_aligned);
+      const auto scaled = stdx::static_simd_cast<Factor>(a) * f;
+      stdx::static_simd_cast<Out>(scaled).copy_to(dst + i,
+                                                  stdx::element_aligned);
+    }
+  }
+#endif
+  for (; i < size; ++i) {
+    dst[i] = static_cast<Out>(static_cast<Factor>(src[i]) * factor);
+  }
+}
+
+namespace Detail {
+
+/**
+ * @brief Describes element types that are laid out as a fixed number of
+ * values of a real type.
+ *
+ * @details Specialisations provide the real type as `Scalar` and the number
+ * of real values in an element as `Count`. Real types are their own scalar.
+ * `std::complex<Real>` is guaranteed by the standard to have the layout of
+ * `Real[2]`, and `std::array` of any packed type adds a further factor.
+ */
+template <typename T>
+struct PackedTraits {};
+
+template <NumericConcepts::Real Real>
+struct PackedTraits<Real> {
+  using Scalar = Real;
+  static constexpr std::size_t Count = 1;
+};
+
+template <NumericConcepts::Real Real>
+struct PackedTraits<std::complex<Real>> {
+  using Scalar = Real;
+  static constexpr std::size_t Count = 2;
+};
+
+template <typename T, std::size_t N>
+  requires requires { typename PackedTraits<T>::Scalar; }
+struct PackedTraits<std::array<T, N>> {
+  using Scalar = typename PackedTraits<T>::Scalar;
+  static constexpr std::size_t Count = N * PackedTraits<T>::Count;
+};
+
+}  // namespace Detail
+
+/**
+ * @brief Concept satisfied by element types, other than real types, that can
+ * be scaled as packed real values.
+ *
+ * @details Examples are `std::complex<double>`, `std::array<float, 6>` for a
+ * symmetric tensor, and `std::array<std::complex<double>, 3>`. The size check
+ * excludes any implementation that pads an element.
+ */
+template <typename T>
+concept PackedReal =
+    !NumericConcepts::Real<T> &&
+    requires { typename Detail::PackedTraits<T>::Scalar; } &&
+    sizeof(T) == Detail::PackedTraits<T>::Count *
+                     sizeof(typename Detail::PackedTraits<T>::Scalar);
+
+/** @brief The real type of the components of a packed element type. */
+template <PackedReal T>
+using PackedScalar = typename Detail::PackedTraits<T>::Scalar;
+
+/**
+ * @brief Views packed elements as their real components.
+ * @param values The packed data.
+ * @return A span of `Count` real values for each element of `values`.
+ */
+template <PackedReal T>
+std::span<PackedScalar<T>> AsPackedReals(std::span<T> values) noexcept {
+  return {reinterpret_cast<PackedScalar<T>*>(values.data()),
+          values.size() * Detail::PackedTraits<T>::Count};
+}
+
+/** @brief Views constant packed elements as their real components. */
+template <PackedReal T>
+std::span<const PackedScalar<T>> AsPackedReals(
+    std::span<const T> values) noexcept {
+  return {reinterpret_cast<const PackedScalar<T>*>(values.data()),
+          values.size() * Detail::PackedTraits<T>::Count};
+}
+
+/**
+ * @brief Multiplies every component of every packed element of `values` in
+ * place by a real factor.
+ *
+ * @details The data is scaled as one contiguous array of real values by the
+ * vectorised real kernel, rather than by a complex multiplication per
+ * element.
+ *
+ * @tparam T The packed element type.
+ * @param values The data to be scaled.
+ * @param factor The scaling factor.
+ */
+template <PackedReal T>
+void Multiply(std::span<T> values, PackedScalar<T> factor) noexcept {
+  Multiply(AsPackedReals(values), factor);
+}
+
+/**
+ * @brief Writes each packed element of `in` multiplied by a real factor into
+ * `out`.
+ * @tparam T The packed element type.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factor The scaling factor.
+ */
+template <PackedReal T>
+void Multiply(std::type_identity_t<std::span<const T>> in, std::span<T> out,
+              PackedScalar<T> factor) noexcept {
+  assert(in.size() == out.size());
+  Multiply(AsPackedReals(in), AsPackedReals(out), factor);
+}
+
+namespace Detail {
+
+/**
+ * @brief The length of the repeated factor pattern used for interleaved data.
+ */
+inline constexpr std::size_t PatternLength = 64;
+
+/**
+ * @brief Fills `pattern` with as many whole copies of `factors` as fit, and
+ * returns the number of elements written.
+ */
+template <typename Real>
+std::size_t FillPattern(std::span<const Real> factors,
+                        Real (&pattern)[PatternLength]) noexcept {
+  const auto components = factors.size();
+  const auto length = PatternLength / components * components;
+  for (std::size_t i = 0; i < length; ++i) pattern[i] = factors[i % components];
+  return length;
+}
+
+}  // namespace Detail
+
+/**
+ * @brief Scales interleaved records in place with a different factor for each
+ * component.
+ *
+ * @details The data is treated as consecutive records of `factors.size()`
+ * components. The factors are repeated into a short pattern whose length is a
+ * multiple of the number of components, so that the inner loop runs over
+ * contiguous data with a contiguous factor array and every component is
+ * scaled in the same pass. If the size of the data is not a multiple of the
+ * number of components, only the complete records are scaled and the
+ * trailing values are left unchanged.
+ *
+ * @param values The data, as consecutive records.
+ * @param factors The scaling factor for each component.
+ */
+template <NumericConcepts::Real Real>
+void MultiplyInterleaved(std::span<Real> values,
+                         std::span<const Real> factors) noexcept {
+  const auto components = factors.size();
+  if (components == 0) return;
+  if (components == 1) return Multiply(values, factors[0]);
+  auto* data = values.data();
+  const auto size = values.size() / components * components;
+  std::size_t i = 0;
+  if (components <= Detail::PatternLength) {
+    Real pattern[Detail::PatternLength];
+    const auto length = Detail::FillPattern(factors, pattern);
+    for (; i + length <= size; i += length) {
+      for (std::size_t j = 0; j < length; ++j) data[i + j] *= pattern[j];
+    }
+  }
+  for (; i < size; i += components) {
+    for (std::size_t j = 0; j < components; ++j) data[i + j] *= factors[j];
+  }
+}
+
+/**
+ * @brief Writes interleaved records scaled with a different factor for each
+ * component into `out`.
+ * @details Only complete records are written, as for the in-place overload,
+ * so trailing elements of `out` that do not form a record are left unchanged.
+ * @param in The data, as consecutive records.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factors The scaling factor for each component.
+ */
+template <NumericConcepts::Real Real>
+void MultiplyInterleaved(std::span<const Real> in, std::span<Real> out,
+                         std::span<const Real> factors) noexcept {
+  assert(in.size() == out.size());
+  const auto components = factors.size();
+  if (components == 0) return;
+  if (components == 1) return Multiply(in, out, factors[0]);
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size() / components * components;
+  std::size_t i = 0;
+  if (components <= Detail::PatternLength) {
+    Real pattern[Detail::PatternLength];
+    const auto length = Detail::FillPattern(factors, pattern);
+    for (; i + length <= size; i += length) {
+      for (std::size_t j = 0; j < length; ++j) {
+        dst[i + j] = src[i + j] * pattern[j];
+      }
+    }
+  }
+  for (; i < size; i += components) {
+    for (std::size_t j = 0; j < components; ++j) {
+      dst[i + j] = src[i + j] * factors[j];
+    }
+  }
+}
+
+/**
+ * @brief Multiplies `count` elements separated by `stride` in place.
+ * @param data Pointer to the first element.
+ * @param count The number of elements.
+ * @param stride The distance between consecutive elements.
+ * @param factor The scaling factor.
+ */
+template <NumericConcepts::Real Real>
+void MultiplyStrided(Real* data, std::size_t count, std::ptrdiff_t stride,
+                     Real factor) noexcept {
+  if (stride == 1) return Multiply(std::span<Real>(data, count), factor);
+  for (std::size_t i = 0; i < count; ++i) {
+    data[static_cast<std::ptrdiff_t>(i) * stride] *= factor;
+  }
+}
+
+#if DIMENSIONS_HAS_MDSPAN
+/**
+ * @brief Multiplies every element of a rank-one `mdspan` in place.
+ *
+ * @details Exhaustive layouts use the contiguous kernel, strided layouts the
+ * strided kernel, and any other layout falls back to indexing through the
+ * mapping.
+ */
+template <NumericConcepts::Real Real, typename Extents, typename Layout,
+          typename Accessor>
+  requires(Extents::rank() == 1)
+void Multiply(std::mdspan<Real, Extents, Layout, Accessor> field,
+              Real factor) noexcept {
+  using Default = std::default_accessor<Real>;
+  if constexpr (std::is_same_v<Accessor, Default>) {
+    if (field.is_exhaustive()) {
+      return Multiply(std::span<Real>(field.data_handle(), field.size()),
+                      factor);
+    }
+    if (field.is_strided()) {
+      return MultiplyStrided(field.data_handle(), field.extent(0),
+                             static_cast<std::ptrdiff_t>(field.stride(0)),
+                             factor);
+    }
+  }
+  for (std::size_t i = 0; i < field.extent(0); ++i) field[i] *= factor;
+}
+
+/**
+ * @brief Scales a rank-two `mdspan` in place, with one factor for each
+ * column.
+ *
+ * @details Rows are records and columns their components. Row-major data is
+ * processed as interleaved records in one pass, column-major data one
+ * contiguous column at a time, and other layouts through their strides or
+ * mapping.
+ */
+template <NumericConcepts::Real Real, typename Extents, typename Layout,
+          typename Accessor>
+  requires(Extents::rank() == 2)
+void MultiplyComponents(std::mdspan<Real, Extents, Layout, Accessor> field,
+                        std::span<const Real> factors) noexcept {
+  assert(field.extent(1) == factors.size());
+  using Default = std::default_accessor<Real>;
+  const auto rows = field.extent(0);
+  const auto columns = field.extent(1);
+  if constexpr (std::is_same_v<Accessor, Default>) {
+    if (field.is_exhaustive() && field.is_strided() && field.stride(1) == 1) {
+      return MultiplyInterleaved(
+          std::span<Real>(field.data_handle(), field.size()), factors);
+    }
+    if (field.is_strided()) {
+      for (std::size_t j = 0; j < columns; ++j) {
+        MultiplyStrided(field.data_handle() + j * field.stride(1), rows,
+                        static_cast<std::ptrdiff_t>(field.stride(0)),
+                        factors[j]);
+      }
+      return;
+    }
+  }
+  for (std::size_t i = 0; i < rows; ++i) {
+    for (std::size_t j = 0; j < columns; ++j) field[i, j] *= factors[j];
+  }
+}
+#endif
+
+}  // namespace Dimensions::Kernels
+
+/**
+ * @brief Declares or defines the explicit instantiations of the kernels for
+ * one numeric type.
+ *
+ * @details `Instantiation` is `extern template` for a declaration and
+ * `template` for a definition.
+ */
+#define DIMENSIONS_INSTANTIATE_KERNELS(Instantiation, Real)                   \
+  Instantiation void Dimensions::Kernels::Multiply<Real>(std::span<Real>,     \
+                                                         Real) noexcept;      \
+  Instantiation void Dimensions::Kernels::Multiply<Real>(                     \
+      std::span<const Real>, std::span<Real>, Real) noexcept;                 \
+  Instantiation void Dimensions::Kernels::MultiplyInterleaved<Real>(          \
+      std::span<Real>, std::span<const Real>) noexcept;                       \
+  Instantiation void Dimensions::Kernels::MultiplyInterleaved<Real>(          \
+      std::span<const Real>, std::span<Real>, std::span<const Real>) noexcept; \
+  Instantiation void Dimensions::Kernels::MultiplyStrided<Real>(              \
+      Real*, std::size_t, std::ptrdiff_t, Real) noexcept;
+
+// When linking against the Dimensions::Instantiations library, the kernels
+// for float and double are compiled once there rather than in every
+// translation unit.
+#if defined(DIMENSIONS_EXTERN_TEMPLATES)
+DIMENSIONS_INSTANTIATE_KERNELS(extern template, float)
+DIMENSIONS_INSTANTIATE_KERNELS(extern template, double)
+#endif
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Parallel.hpp
+ * @brief Batch conversion of large fields using standard execution policies.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details The data is split into large contiguous chunks whose sizes are
+ * multiples of a page, so that each task streams through its own region of
+ * memory using the serial kernels from `Kernels.hpp`. This header is kept
+ * separate from `Dimensions.hpp` because with libstdc++ including
+ * `<execution>` requires linking against TBB.
+ */
+
+namespace Dimensions {
+
+namespace Kernels {
+
+namespace Detail {
+
+/**
+ * @brief The smallest number of bytes handed to a single parallel task.
+ */
+inline constexpr std::size_t MinimumChunkBytes = std::size_t{1} << 18;
+
+/**
+ * @brief Granularity of chunk sizes, chosen to match the page size.
+ */
+inline constexpr std::size_t ChunkGranularityBytes = 4096;
+
+/**
+ * @brief Returns the number of elements in each parallel chunk.
+ *
+ * @details Roughly four chunks are formed per hardware thread, subject to a
+ * minimum chunk size, rounded up to a whole number of pages.
+ */
+template <typename Real>
+std::size_t ChunkSize(std::size_t size) noexcept {
+  constexpr auto granularity = ChunkGranularityBytes / sizeof(Real);
+  const auto threads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  const auto chunk = std::max(MinimumChunkBytes / sizeof(Real),
+                              (size + 4 * threads - 1) / (4 * threads));
+  return (chunk + granularity - 1) / granularity * granularity;
+}
+
+/**
+ * @brief Returns the offsets of the chunks into which `size` elements are
+ * divided.
+ */
+inline std::vector<std::size_t> ChunkOffsets(std::size_t size,
+                                             std::size_t chunk) {
+  auto offsets = std::vector<std::size_t>();
+  offsets.reserve((size + chunk - 1) / chunk);
+  for (std::size_t offset = 0; offset < size; offset += chunk) {
+    offsets.push_back(offset);
+  }
+  return offsets;
+}
+
+}  // namespace Detail
+
+/**
+ * @brief Concept satisfied by the standard execution policy types.
+ */
+template <typename T>
+concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<T>>;
+
+/**
+ * @brief Multiplies every element of `values` in place by `factor` using an
+ * execution policy.
+ * @param policy The execution policy.
+ * @param values The data to be scaled.
+ * @param factor The scaling factor.
+ */
+template <ExecutionPolicy Policy, NumericConcepts::Real Real>
+void Multiply(Policy&& policy, std::span<Real> values, Real factor) {
+  const auto chunk = Detail::ChunkSize<Real>(values.size());
+  const auto offsets = Detail::ChunkOffsets(values.size(), chunk);
+  std::for_each(std::forward<Policy>(policy), offsets.begin(), offsets.end(),
+                [=](std::size_t offset) {
+                  const auto count = std::min(chunk, values.size() - offset);
+                  Multiply(values.subspan(offset, count), factor);
+                });
+}
+
+/**
+ * @brief Writes each element of `in` multiplied by `factor` into `out` using
+ * an execution policy.
+ * @param policy The execution policy.
+ * @param in The data to be scaled.
+ * @param out The destination, which must be the same size as `in`.
+ * @param factor The scaling factor.
+ */
+template <ExecutionPolicy Policy, NumericConcepts::Real Real>
+void Multiply(Policy&& policy, std::span<const Real> in, std::span<Real> out,
+              Real factor) {
+  assert(in.size() == out.size());
+  const auto chunk = Detail::ChunkSize<Real>(in.size());
+  const auto offsets = Detail::ChunkOffsets(in.size(), chunk);
+  std::for_each(std::forward<Policy>(policy), offsets.begin(), offsets.end(),
+                [=](std::size_t offset) {
+                  const auto count = std::min(chunk, in.size() - offset);
+                  Multiply(in.subspan(offset, count),
+                           out.subspan(offset, count), factor);
+                });
+}
+
+}  // namespace Kernels
+
+/** @name Parallel Batch Conversion
+ * @brief Execution-policy counterparts of the batch conversion methods of
+ * `Dimensions` and of `Convert`.
+ * @{
+ */
+
+/**
+ * @brief Converts dimensional values to nondimensional form in place.
+ * @param policy A standard execution policy.
+ * @param system The unit system.
+ * @param values The data to be converted.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename Derived_, typename Real>
+void Nondimensionalise(Policy&& policy,
+                       const Dimensions<Derived_, Real>& system,
+                       std::span<Real> values, QuantityKind kind) {
+  const auto& derived = static_cast<const Derived_&>(system);
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), values,
+                    derived.InverseScale(kind));
+}
+
+/**
+ * @brief Converts dimensional values to nondimensional form.
+ * @param policy A standard execution policy.
+ * @param system The unit system.
+ * @param in The dimensional data.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename Derived_, typename Real>
+void Nondimensionalise(Policy&& policy,
+                       const Dimensions<Derived_, Real>& system,
+                       std::span<const Real> in, std::span<Real> out,
+                       QuantityKind kind) {
+  const auto& derived = static_cast<const Derived_&>(system);
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), in, out,
+                    derived.InverseScale(kind));
+}
+
+/**
+ * @brief Converts nondimensional values to dimensional form in place.
+ * @param policy A standard execution policy.
+ * @param system The unit system.
+ * @param values The data to be converted.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename Derived_, typename Real>
+void Redimensionalise(Policy&& policy,
+                      const Dimensions<Derived_, Real>& system,
+                      std::span<Real> values, QuantityKind kind) {
+  const auto& derived = static_cast<const Derived_&>(system);
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), values, derived.Scale(kind));
+}
+
+/**
+ * @brief Converts nondimensional values to dimensional form.
+ * @param policy A standard execution policy.
+ * @param system The unit system.
+ * @param in The nondimensional data.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename Derived_, typename Real>
+void Redimensionalise(Policy&& policy,
+                      const Dimensions<Derived_, Real>& system,
+                      std::span<const Real> in, std::span<Real> out,
+                      QuantityKind kind) {
+  const auto& derived = static_cast<const Derived_&>(system);
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), in, out,
+                    derived.Scale(kind));
+}
+
+/**
+ * @brief Converts nondimensional values between unit systems in place.
+ * @param policy A standard execution policy.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param values The data to be converted.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename From, typename To,
+          NumericConcepts::Real Real>
+void Convert(Policy&& policy, const From& from, const To& to,
+             std::span<Real> values, QuantityKind kind) {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), values.size(), 2 * values.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), values,
+                    static_cast<Real>(ConversionFactor(from, to, kind)));
+}
+
+/**
+ * @brief Converts nondimensional values between unit systems.
+ * @param policy A standard execution policy.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param in The data to be converted.
+ * @param out The destination, which must be the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <Kernels::ExecutionPolicy Policy, typename From, typename To,
+          NumericConcepts::Real Real>
+void Convert(Policy&& policy, const From& from, const To& to,
+             std::span<const Real> in, std::span<Real> out,
+             QuantityKind kind) {
+  DIMENSIONS_INSTRUMENT_CONVERSION(
+      Instrumentation::Slot(kind), in.size(),
+      in.size_bytes() + out.size_bytes());
+  Kernels::Multiply(std::forward<Policy>(policy), in, out,
+                    static_cast<Real>(ConversionFactor(from, to, kind)));
+}
+/** @} */
+
+}  // namespace Dimensions
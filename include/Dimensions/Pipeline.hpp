@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Instrumentation.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Pipeline.hpp
+ * @brief Conversion of streamed chunks on a worker thread, overlapping the
+ * scaling with input.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A `ConversionPipeline` owns a fixed number of chunk buffers. A
+ * producer, typically a reader, acquires a free buffer, fills it and submits
+ * it. A worker thread scales each submitted chunk in place, in order, and
+ * passes it to a sink before returning the buffer to the free list. While the
+ * worker scales one chunk the producer can read the next, and the memory used
+ * is bounded by the number of buffers rather than by the size of the field:
+ *
+ * \code{.cpp}
+ * auto pipeline = Dimensions::MakeRedimensionalisePipeline(
+ *     system, QuantityKind::Velocity, 1 << 16, 4,
+ *     [&](std::span<const double> chunk) { Append(chunk); });
+ * pipeline.Pump([&](std::span<double> buffer) { return Read(file, buffer); });
+ * \endcode
+ *
+ * The sink is called on the worker thread.
+ */
+
+namespace Dimensions {
+
+/**
+ * @brief A bounded, single-worker stage that scales chunks of a field as they
+ * arrive.
+ * @tparam Real The numeric type of the data.
+ */
+template <NumericConcepts::Real Real>
+class ConversionPipeline {
+ public:
+  /** @brief A callable that receives each scaled chunk, in order. */
+  using Sink = std::function<void(std::span<const Real>)>;
+
+  /**
+   * @brief Constructs the pipeline and starts its worker.
+   * @param factor The factor applied to every element.
+   * @param kind The physical quantity of the data, used for instrumentation.
+   * @param chunkSize The number of elements in each buffer.
+   * @param chunksInFlight The number of buffers, which must be positive.
+   * @param sink The callable that receives each scaled chunk.
+   */
+  ConversionPipeline(Real factor, QuantityKind kind, std::size_t chunkSize,
+                     std::size_t chunksInFlight, Sink sink)
+      : factor_{factor},
+        kind_{kind},
+        chunkSize_{chunkSize},
+        storage_(chunkSize * chunksInFlight),
+        sink_{std::move(sink)} {
+    assert(chunkSize > 0 && chunksInFlight > 0);
+    for (std::size_t i = chunksInFlight; i > 0; --i) free_.push_back(i - 1);
+    worker_ = std::thread([this] { Work(); });
+  }
+
+  ConversionPipeline(const ConversionPipeline&) = delete;
+  ConversionPipeline& operator=(const ConversionPipeline&) = delete;
+
+  /** @brief Processes every submitted chunk and stops the worker. */
+  ~ConversionPipeline() {
+    {
+      const auto lock = std::lock_guard(mutex_);
+      stopping_ = true;
+    }
+    changed_.notify_all();
+    worker_.join();
+  }
+
+  /** @brief Returns the number of elements in each buffer. */
+  std::size_t ChunkSize() const noexcept { return chunkSize_; }
+
+  /**
+   * @brief Returns a free buffer, waiting until one is available.
+   * @return A buffer of `ChunkSize()` elements.
+   */
+  std::span<Real> Acquire() {
+    auto lock = std::unique_lock(mutex_);
+    changed_.wait(lock, [this] { return !free_.empty() || error_; });
+    Rethrow();
+    const auto index = free_.back();
+    free_.pop_back();
+    return {storage_.data() + index * chunkSize_, chunkSize_};
+  }
+
+  /**
+   * @brief Queues a filled buffer for scaling.
+   * @param chunk A leading part of a buffer returned by `Acquire`. An empty
+   * chunk returns the buffer without calling the sink.
+   */
+  void Submit(std::span<Real> chunk) {
+    const auto index =
+        static_cast<std::size_t>(chunk.data() - storage_.data()) / chunkSize_;
+    assert(index * chunkSize_ + chunk.size() <= storage_.size());
+    {
+      const auto lock = std::lock_guard(mutex_);
+      if (chunk.empty()) {
+        free_.push_back(index);
+      } else {
+        queue_.push_back({index, chunk.size()});
+        ++pending_;
+      }
+    }
+    changed_.notify_all();
+  }
+
+  /**
+   * @brief Waits until every submitted chunk has been passed to the sink.
+   * @details If the sink has thrown, the exception is rethrown here, and by
+   * every later call of `Acquire` or `Finish`, and no further chunks are
+   * passed to it.
+   */
+  void Finish() {
+    auto lock = std::unique_lock(mutex_);
+    changed_.wait(lock, [this] { return pending_ == 0 || error_; });
+    Rethrow();
+  }
+
+  /**
+   * @brief Fills buffers from a reader until it is exhausted, then waits for
+   * the last chunk.
+   * @param read A callable that fills a leading part of the span it is given
+   * and returns the number of elements written, zero at the end of the data.
+   */
+  template <typename Reader>
+  void Pump(Reader&& read) {
+    for (;;) {
+      const auto buffer = Acquire();
+      const auto count = static_cast<std::size_t>(read(buffer));
+      Submit(buffer.first(count));
+      if (count == 0) break;
+    }
+    Finish();
+  }
+
+ private:
+  struct Pending {
+    std::size_t index;
+    std::size_t size;
+  };
+
+  Real factor_;
+  QuantityKind kind_;
+  std::size_t chunkSize_;
+  std::vector<Real> storage_;
+  Sink sink_;
+
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  std::deque<Pending> queue_;
+  std::vector<std::size_t> free_;
+  std::size_t pending_ = 0;
+  std::exception_ptr error_;
+  bool stopping_ = false;
+  std::thread worker_;
+
+  // Must be called with the mutex held.
+  void Rethrow() {
+    if (error_) std::rethrow_exception(error_);
+  }
+
+  void Work() {
+    auto lock = std::unique_lock(mutex_);
+    auto failed = false;
+    for (;;) {
+      changed_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (queue_.empty()) return;
+      const auto job = queue_.front();
+      queue_.pop_front();
+      lock.unlock();
+      const auto chunk =
+          std::span<Real>(storage_.data() + job.index * chunkSize_, job.size);
+      auto error = std::exception_ptr();
+      if (!failed) {
+        {
+          DIMENSIONS_INSTRUMENT_CONVERSION(Instrumentation::Slot(kind_),
+                                           chunk.size(),
+                                           2 * chunk.size_bytes());
+          Kernels::Multiply(chunk, factor_);
+        }
+        try {
+          sink_(std::span<const Real>(chunk));
+        } catch (...) {
+          error = std::current_exception();
+          failed = true;
+        }
+      }
+      lock.lock();
+      if (error) error_ = error;
+      free_.push_back(job.index);
+      --pending_;
+      changed_.notify_all();
+    }
+  }
+};
+
+/**
+ * @brief Returns a pipeline that converts nondimensional chunks to
+ * dimensional form.
+ * @param system The unit system.
+ * @param kind The physical quantity that the data represents.
+ * @param chunkSize The number of elements in each buffer.
+ * @param chunksInFlight The number of buffers.
+ * @param sink The callable that receives each converted chunk.
+ */
+template <typename Derived_, NumericConcepts::Real Real>
+ConversionPipeline<Real> MakeRedimensionalisePipeline(
+    const Dimensions<Derived_, Real>& system, QuantityKind kind,
+    std::size_t chunkSize, std::size_t chunksInFlight,
+    typename ConversionPipeline<Real>::Sink sink) {
+  return ConversionPipeline<Real>(
+      static_cast<const Derived_&>(system).Scale(kind), kind, chunkSize,
+      chunksInFlight, std::move(sink));
+}
+
+/**
+ * @brief Returns a pipeline that converts dimensional chunks to
+ * nondimensional form.
+ * @param system The unit system.
+ * @param kind The physical quantity that the data represents.
+ * @param chunkSize The number of elements in each buffer.
+ * @param chunksInFlight The number of buffers.
+ * @param sink The callable that receives each converted chunk.
+ */
+template <typename Derived_, NumericConcepts::Real Real>
+ConversionPipeline<Real> MakeNondimensionalisePipeline(
+    const Dimensions<Derived_, Real>& system, QuantityKind kind,
+    std::size_t chunkSize, std::size_t chunksInFlight,
+    typename ConversionPipeline<Real>::Sink sink) {
+  return ConversionPipeline<Real>(
+      static_cast<const Derived_&>(system).InverseScale(kind), kind,
+      chunkSize, chunksInFlight, std::move(sink));
+}
+
+/**
+ * @brief Returns a pipeline that converts nondimensional chunks between unit
+ * systems with the fused `ConversionFactor`.
+ * @tparam Real The numeric type of the data.
+ * @param from The unit system in which the chunks are nondimensional.
+ * @param to The unit system into which they are converted.
+ * @param kind The physical quantity that the data represents.
+ * @param chunkSize The number of elements in each buffer.
+ * @param chunksInFlight The number of buffers.
+ * @param sink The callable that receives each converted chunk.
+ */
+template <NumericConcepts::Real Real, typename From, typename To>
+ConversionPipeline<Real> MakeConvertPipeline(
+    const From& from, const To& to, QuantityKind kind, std::size_t chunkSize,
+    std::size_t chunksInFlight, typename ConversionPipeline<Real>::Sink sink) {
+  return ConversionPipeline<Real>(
+      static_cast<Real>(ConversionFactor(from, to, kind)), kind, chunkSize,
+      chunksInFlight, std::move(sink));
+}
+
+}  // namespace Dimensions
@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+ * @file Portability.hpp
+ * @brief Macros that make the scale accessors callable from GPU kernels.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details `DIMENSIONS_HOST_DEVICE` marks functions that may be called from
+ * both host and device code. It expands to `__host__ __device__` when
+ * compiling with CUDA or HIP, and to nothing otherwise. SYCL requires no
+ * annotation, since device code may call any inline function whose body is
+ * visible.
+ */
+
+#if defined(__CUDACC__) || defined(__HIPCC__)
+#define DIMENSIONS_HOST_DEVICE __host__ __device__
+#else
+#define DIMENSIONS_HOST_DEVICE
+#endif
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Quantisation.hpp
+ * @brief Fixed-point encoding of nondimensional fields as signed integers.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A `Quantiser` maps a closed range of nondimensional values onto
+ * the symmetric integer codes [-N, N], where N = 2^(Bits - 1) - 1, by an
+ * offset and a uniform step. Values inside the range are reproduced to within
+ * half a step, and values outside it are clamped to the nearest end. The
+ * free `Quantise` and `Dequantise` functions fold the scale of a unit system
+ * into the same affine map, so that dimensional data is nondimensionalised
+ * and encoded, or decoded and redimensionalised, in a single pass.
+ */
+
+namespace Dimensions {
+
+namespace Kernels {
+
+namespace Detail {
+
+/**
+ * @brief Returns the largest `Real` that does not exceed `limit`.
+ * @details A `limit` with more digits than `Real` may round up when it is
+ * converted, e.g. 2^31 - 1 rounds to 2^31 as a `float`, and that value would
+ * be out of range when converted back to `Code`.
+ */
+template <NumericConcepts::Real Real, std::signed_integral Code>
+Real ClampBound(Code limit) noexcept {
+  constexpr auto digits = std::numeric_limits<Code>::digits;
+  // 2^digits, the first value beyond the range of Code, formed exactly.
+  constexpr auto end = 2 * static_cast<Real>(Code{1} << (digits - 1));
+  auto bound = static_cast<Real>(limit);
+  if (bound >= end || static_cast<Code>(bound) > limit) {
+    bound = std::nextafter(bound, Real{0});
+  }
+  return bound;
+}
+
+/**
+ * @brief Rounds `y` to the nearest code, clamping it to [-bound, bound].
+ * @details `bound` is an integer obtained from `ClampBound`. Values that are
+ * not numbers are mapped to `-bound`.
+ */
+template <std::signed_integral Code, NumericConcepts::Real Real>
+Code QuantiseValue(Real y, Real bound) noexcept {
+  if (!(y > -bound)) y = -bound;
+  if (y > bound) y = bound;
+  return static_cast<Code>(std::round(y));
+}
+
+}  // namespace Detail
+
+/**
+ * @brief Writes round(gain * x + bias) for each element x of `in` into
+ * `out`, clamped to [-limit, limit].
+ * @details Where `limit` is not representable in `Real` the codes are
+ * clamped to the largest representable magnitude below it instead.
+ * @param in The data to be encoded.
+ * @param out The destination, which must be the same size as `in`.
+ * @param gain The factor applied to each element.
+ * @param bias The offset added after multiplying.
+ * @param limit The largest code magnitude.
+ */
+template <NumericConcepts::Real Real, std::signed_integral Code>
+void Quantise(std::span<const Real> in, std::span<Code> out, Real gain,
+              Real bias, Code limit) noexcept {
+  assert(in.size() == out.size());
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size();
+  const auto bound = Detail::ClampBound<Real>(limit);
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  namespace stdx = Detail::stdx;
+  using Simd = stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  const Simd g = gain;
+  const Simd b = bias;
+  const Simd hi = bound;
+  const Simd lo = -hi;
+  for (; i + width <= size; i += width) {
+    auto y = Simd(src + i, stdx::element_aligned) * g + b;
+    where(!(y > lo), y) = lo;
+    where(y > hi, y) = hi;
+    stdx::static_simd_cast<Code>(stdx::round(y)).copy_to(
+        dst + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) {
+    dst[i] = Detail::QuantiseValue<Code>(src[i] * gain + bias, bound);
+  }
+}
+
+/**
+ * @brief Writes gain * c + bias for each code c of `in` into `out`.
+ * @param in The codes to be decoded.
+ * @param out The destination, which must be the same size as `in`.
+ * @param gain The factor applied to each code.
+ * @param bias The offset added after multiplying.
+ */
+template <std::signed_integral Code, NumericConcepts::Real Real>
+void Dequantise(std::span<const Code> in, std::span<Real> out, Real gain,
+                Real bias) noexcept {
+  assert(in.size() == out.size());
+  const auto* src = in.data();
+  auto* dst = out.data();
+  const auto size = in.size();
+  std::size_t i = 0;
+#if DIMENSIONS_HAS_SIMD
+  namespace stdx = Detail::stdx;
+  using Simd = stdx::native_simd<Real>;
+  constexpr auto width = Simd::size();
+  using Codes = stdx::fixed_size_simd<Code, width>;
+  const Simd g = gain;
+  const Simd b = bias;
+  for (; i + width <= size; i += width) {
+    const auto c = Codes(src + i, stdx::element_aligned);
+    const Simd y = stdx::static_simd_cast<Simd>(c) * g + b;
+    y.copy_to(dst + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) dst[i] = static_cast<Real>(src[i]) * gain + bias;
+}
+
+}  // namespace Kernels
+
+/**
+ * @brief A uniform fixed-point encoding of a range of values.
+ *
+ * @details The range [minimum, maximum] is mapped onto the codes
+ * [-MaximumCode, MaximumCode], with the centre of the range encoded as zero.
+ * Using fewer bits than the width of `Code` leaves headroom, e.g. for
+ * subsequent entropy coding.
+ *
+ * If `MaximumCode` is not representable in `Real`, as for 32-bit codes of
+ * `float` values, out-of-range values saturate at the largest representable
+ * code below it, e.g. 2^31 - 128.
+ *
+ * @tparam Code The signed integer type of the codes.
+ * @tparam Real The numeric type of the decoded values. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ * @tparam Bits The number of bits used by each code, including the sign.
+ */
+template <std::signed_integral Code, NumericConcepts::Real Real = double,
+          int Bits = std::numeric_limits<Code>::digits + 1>
+class Quantiser {
+  static_assert(Bits >= 2 && Bits <= std::numeric_limits<Code>::digits + 1,
+                "The bit budget must fit within the code type.");
+
+ public:
+  using CodeType = Code;
+  using ValueType = Real;
+
+  /** @brief The largest code magnitude, 2^(Bits - 1) - 1. */
+  static constexpr Code MaximumCode =
+      std::numeric_limits<Code>::max() >>
+      (std::numeric_limits<Code>::digits + 1 - Bits);
+
+  /**
+   * @brief Constructs an encoding of the range [minimum, maximum].
+   * @param minimum The smallest value represented, which must be less than
+   * `maximum`.
+   * @param maximum The largest value represented.
+   */
+  constexpr Quantiser(Real minimum, Real maximum) noexcept
+      : offset_{(minimum + maximum) / 2},
+        step_{(maximum - minimum) / (2 * static_cast<Real>(MaximumCode))},
+        inverseStep_{1 / step_} {
+    assert(minimum < maximum);
+  }
+
+  /**
+   * @brief Constructs an encoding of the range [-bound, bound].
+   * @param bound The largest magnitude represented, which must be positive.
+   * @return The quantiser.
+   */
+  static constexpr Quantiser Symmetric(Real bound) noexcept {
+    return Quantiser(-bound, bound);
+  }
+
+  /** @brief Returns the value encoded as zero. */
+  constexpr Real Offset() const noexcept { return offset_; }
+
+  /** @brief Returns the difference between the values of adjacent codes. */
+  constexpr Real Step() const noexcept { return step_; }
+
+  /** @brief Returns the reciprocal of the step. */
+  constexpr Real InverseStep() const noexcept { return inverseStep_; }
+
+  /** @brief Returns the smallest value represented. */
+  constexpr Real Minimum() const noexcept {
+    return offset_ - MaximumCode * step_;
+  }
+
+  /** @brief Returns the largest value represented. */
+  constexpr Real Maximum() const noexcept {
+    return offset_ + MaximumCode * step_;
+  }
+
+  /**
+   * @brief Returns the largest error in a decoded value that lies within the
+   * range, neglecting the rounding of the affine map itself.
+   */
+  constexpr Real MaximumError() const noexcept { return step_ / 2; }
+
+  /**
+   * @brief Encodes a single value.
+   * @param value The value to be encoded.
+   * @return The nearest code, with values outside the range clamped.
+   */
+  Code Encode(Real value) const noexcept {
+    return Kernels::Detail::QuantiseValue<Code>(
+        value * inverseStep_ - offset_ * inverseStep_,
+        Kernels::Detail::ClampBound<Real>(MaximumCode));
+  }
+
+  /**
+   * @brief Decodes a single code.
+   * @param code The code to be decoded.
+   * @return The value represented by the code.
+   */
+  constexpr Real Decode(Code code) const noexcept {
+    return static_cast<Real>(code) * step_ + offset_;
+  }
+
+  /**
+   * @brief Encodes a batch of values.
+   * @param in The values to be encoded.
+   * @param out The destination, which must be the same size as `in`.
+   */
+  void Encode(std::span<const Real> in, std::span<Code> out) const noexcept {
+    Kernels::Quantise(in, out, inverseStep_, -offset_ * inverseStep_,
+                      MaximumCode);
+  }
+
+  /**
+   * @brief Decodes a batch of codes.
+   * @param in The codes to be decoded.
+   * @param out The destination, which must be the same size as `in`.
+   */
+  void Decode(std::span<const Code> in, std::span<Real> out) const noexcept {
+    Kernels::Dequantise(in, out, step_, offset_);
+  }
+
+ private:
+  Real offset_;
+  Real step_;
+  Real inverseStep_;
+};
+
+/**
+ * @brief Nondimensionalises and encodes dimensional values in one pass.
+ *
+ * @details The range of the quantiser is given in nondimensional units, so
+ * that a range such as [-1, 1] is set relative to the scale of the quantity.
+ *
+ * @param system The unit system.
+ * @param quantiser The encoding of the nondimensional values.
+ * @param in The dimensional data.
+ * @param out The destination for the codes, the same size as `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename Derived_, typename Real, std::signed_integral Code,
+          int Bits>
+void Quantise(const Dimensions<Derived_, Real>& system,
+              const Quantiser<Code, Real, Bits>& quantiser,
+              std::span<const Real> in, std::span<Code> out,
+              QuantityKind kind) noexcept {
+  const auto& derived = static_cast<const Derived_&>(system);
+  const auto gain = derived.InverseScale(kind) * quantiser.InverseStep();
+  Kernels::Quantise(in, out, gain,
+                    -quantiser.Offset() * quantiser.InverseStep(),
+                    quantiser.MaximumCode);
+}
+
+/**
+ * @brief Decodes and redimensionalises values in one pass.
+ *
+ * @details For values within the range of the quantiser the dimensional
+ * error is at most `quantiser.MaximumError() * system.Scale(kind)`.
+ *
+ * @param system The unit system.
+ * @param quantiser The encoding of the nondimensional values.
+ * @param in The codes to be decoded.
+ * @param out The destination for the dimensional data, the same size as
+ * `in`.
+ * @param kind The physical quantity that the data represents.
+ */
+template <typename Derived_, typename Real, std::signed_integral Code,
+          int Bits>
+void Dequantise(const Dimensions<Derived_, Real>& system,
+                const Quantiser<Code, Real, Bits>& quantiser,
+                std::span<const Code> in, std::span<Real> out,
+                QuantityKind kind) noexcept {
+  const auto& derived = static_cast<const Derived_&>(system);
+  const auto scale = derived.Scale(kind);
+  Kernels::Dequantise(in, out, quantiser.Step() * scale,
+                      quantiser.Offset() * scale);
+}
+
+}  // namespace Dimensions
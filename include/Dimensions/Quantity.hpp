@@ -0,0 +1,142 @@
+#pragma once
+
+#include <compare>
+
+#include "Dimensions/Dimension.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Quantity.hpp
+ * @brief A strongly-typed value whose physical dimension is part of its type.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ */
+
+namespace Dimensions {
+
+/**
+ * @brief A value of type `Real` tagged with a physical dimension.
+ *
+ * @details The dimension is carried only in the type, so a `Quantity` has the
+ * same size and layout as `Real` and all arithmetic compiles to the
+ * corresponding operations on `Real`. Addition and subtraction are defined
+ * only between quantities of the same dimension, while multiplication and
+ * division produce quantities whose dimension is computed at compile time.
+ *
+ * Conversion to and from nondimensional form is provided by the
+ * `Nondimensionalise` and `Redimensionalise` methods of `Dimensions`.
+ *
+ * @tparam Dim The physical dimension, a specialisation of `Dimension`.
+ * @tparam Real The numeric type of the value. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <PhysicalDimension Dim, NumericConcepts::Real Real = double>
+class Quantity {
+ public:
+  using DimensionType = Dim;
+  using ValueType = Real;
+
+  /** @brief Constructs a quantity with value zero. */
+  constexpr Quantity() noexcept = default;
+
+  /**
+   * @brief Constructs a quantity from its value in SI units.
+   * @param value The value of the quantity.
+   */
+  explicit constexpr Quantity(Real value) noexcept : value_{value} {}
+
+  /** @brief Returns the value of the quantity in SI units. */
+  constexpr Real Value() const noexcept { return value_; }
+
+  /** @brief Dimensionless quantities convert implicitly to `Real`. */
+  constexpr operator Real() const noexcept
+    requires std::same_as<Dim, Dimensionless>
+  {
+    return value_;
+  }
+
+  /** @name Compound Assignment
+   * @{
+   */
+  constexpr Quantity& operator+=(Quantity other) noexcept {
+    value_ += other.value_;
+    return *this;
+  }
+
+  constexpr Quantity& operator-=(Quantity other) noexcept {
+    value_ -= other.value_;
+    return *this;
+  }
+
+  constexpr Quantity& operator*=(Real factor) noexcept {
+    value_ *= factor;
+    return *this;
+  }
+
+  constexpr Quantity& operator/=(Real factor) noexcept {
+    value_ /= factor;
+    return *this;
+  }
+  /** @} */
+
+  /** @name Arithmetic
+   * @{
+   */
+  constexpr Quantity operator+() const noexcept { return *this; }
+
+  constexpr Quantity operator-() const noexcept { return Quantity(-value_); }
+
+  friend constexpr Quantity operator+(Quantity a, Quantity b) noexcept {
+    return Quantity(a.value_ + b.value_);
+  }
+
+  friend constexpr Quantity operator-(Quantity a, Quantity b) noexcept {
+    return Quantity(a.value_ - b.value_);
+  }
+
+  friend constexpr Quantity operator*(Quantity a, Real b) noexcept {
+    return Quantity(a.value_ * b);
+  }
+
+  friend constexpr Quantity operator*(Real a, Quantity b) noexcept {
+    return Quantity(a * b.value_);
+  }
+
+  friend constexpr Quantity operator/(Quantity a, Real b) noexcept {
+    return Quantity(a.value_ / b);
+  }
+
+  friend constexpr auto operator/(Real a, Quantity b) noexcept {
+    return Quantity<DimensionInverse<Dim>, Real>(a / b.value_);
+  }
+  /** @} */
+
+  /** @name Comparison
+   * @{
+   */
+  friend constexpr bool operator==(Quantity, Quantity) noexcept = default;
+  friend constexpr auto operator<=>(Quantity, Quantity) noexcept = default;
+  /** @} */
+
+ private:
+  Real value_ = 0;
+};
+
+/**
+ * @brief Multiplies two quantities, adding the exponents of their dimensions.
+ */
+template <PhysicalDimension A, PhysicalDimension B, typename Real>
+constexpr auto operator*(Quantity<A, Real> a, Quantity<B, Real> b) noexcept {
+  return Quantity<DimensionProduct<A, B>, Real>(a.Value() * b.Value());
+}
+
+/**
+ * @brief Divides two quantities, subtracting the exponents of their
+ * dimensions.
+ */
+template <PhysicalDimension A, PhysicalDimension B, typename Real>
+constexpr auto operator/(Quantity<A, Real> a, Quantity<B, Real> b) noexcept {
+  return Quantity<DimensionQuotient<A, B>, Real>(a.Value() / b.Value());
+}
+
+}  // namespace Dimensions
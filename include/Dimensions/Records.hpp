@@ -0,0 +1,275 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "Dimensions/Dimension.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Records.hpp
+ * @brief Scaling of heterogeneous records described by a list of fields.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A record type, such as a particle or node structure mixing
+ * positions, velocities and densities, is described to the library by a
+ * `RecordLayout` listing each scaled member together with its physical
+ * dimension. The layout precomputes one factor per field from a unit system
+ * and applies all of them in a single loop over an array of records, or
+ * transposes the records into separate scaled columns.
+ */
+
+namespace Dimensions {
+
+namespace Detail {
+
+/**
+ * @brief Describes how the scalar components of a record member are accessed.
+ *
+ * @details Scalars have a single component, while `std::array`s and built-in
+ * arrays of scalars have one component per element.
+ */
+template <typename T>
+struct MemberTraits {
+  using Scalar = T;
+  static constexpr std::size_t Extent = 1;
+  static constexpr T& Component(T& value, std::size_t) noexcept {
+    return value;
+  }
+  static constexpr const T& Component(const T& value, std::size_t) noexcept {
+    return value;
+  }
+};
+
+template <typename T, std::size_t N>
+struct MemberTraits<std::array<T, N>> {
+  using Scalar = T;
+  static constexpr std::size_t Extent = N;
+  static constexpr T& Component(std::array<T, N>& value,
+                                std::size_t i) noexcept {
+    return value[i];
+  }
+  static constexpr const T& Component(const std::array<T, N>& value,
+                                      std::size_t i) noexcept {
+    return value[i];
+  }
+};
+
+template <typename T, std::size_t N>
+struct MemberTraits<T[N]> {
+  using Scalar = T;
+  static constexpr std::size_t Extent = N;
+  static constexpr T& Component(T (&value)[N], std::size_t i) noexcept {
+    return value[i];
+  }
+  static constexpr const T& Component(const T (&value)[N],
+                                      std::size_t i) noexcept {
+    return value[i];
+  }
+};
+
+template <typename MemberPointer>
+struct MemberPointerTraits;
+
+template <typename Class, typename Member>
+struct MemberPointerTraits<Member Class::*> {
+  using ClassType = Class;
+  using MemberType = Member;
+};
+
+}  // namespace Detail
+
+/**
+ * @brief Associates a data member of a record with a physical dimension.
+ *
+ * @tparam Member A pointer to the data member. The member may be a scalar, or
+ * a `std::array` or built-in array of scalars.
+ * @tparam Dim The physical dimension of the member.
+ */
+template <auto Member, PhysicalDimension Dim>
+struct RecordField {
+  using DimensionType = Dim;
+  using RecordType =
+      typename Detail::MemberPointerTraits<decltype(Member)>::ClassType;
+  using MemberType =
+      typename Detail::MemberPointerTraits<decltype(Member)>::MemberType;
+  using Traits = Detail::MemberTraits<MemberType>;
+  using Scalar = typename Traits::Scalar;
+
+  static constexpr auto Pointer = Member;
+  static constexpr std::size_t Extent = Traits::Extent;
+};
+
+/**
+ * @brief Describes the scaled fields of a record type.
+ *
+ * @details Members not listed are left untouched. All listed members must
+ * share the same scalar type.
+ *
+ * @tparam Record The record type.
+ * @tparam Fields Specialisations of `RecordField` for members of `Record`.
+ */
+template <typename Record, typename... Fields>
+class RecordLayout {
+  static_assert(sizeof...(Fields) > 0, "A layout needs at least one field.");
+  static_assert((std::is_same_v<typename Fields::RecordType, Record> && ...),
+                "Every field must be a member of the record type.");
+
+ public:
+  using RecordType = Record;
+  using Real = std::common_type_t<typename Fields::Scalar...>;
+  static_assert((std::is_same_v<typename Fields::Scalar, Real> && ...),
+                "Every field must have the same scalar type.");
+
+  /** @brief The number of listed fields. */
+  static constexpr std::size_t FieldCount = sizeof...(Fields);
+
+  /** @brief The total number of scalar components over all fields. */
+  static constexpr std::size_t ComponentCount = (Fields::Extent + ...);
+
+  /** @brief One factor for each listed field. */
+  using Factors = std::array<Real, FieldCount>;
+
+  /** @brief One output column for each scalar component. */
+  using Columns = std::array<std::span<Real>, ComponentCount>;
+
+  /**
+   * @brief Returns the scaling factor of each field in a unit system.
+   * @param system The unit system.
+   * @return The factors, in the order in which the fields are listed.
+   */
+  template <typename System>
+  static constexpr Factors Scales(const System& system) noexcept {
+    return {static_cast<Real>(
+        system.template Scale<typename Fields::DimensionType>())...};
+  }
+
+  /**
+   * @brief Returns the reciprocal scaling factor of each field in a unit
+   * system.
+   * @param system The unit system.
+   * @return The factors, in the order in which the fields are listed.
+   */
+  template <typename System>
+  static constexpr Factors InverseScales(const System& system) noexcept {
+    return {static_cast<Real>(
+        system.template InverseScale<typename Fields::DimensionType>())...};
+  }
+
+  /**
+   * @brief Multiplies every listed field of every record by its factor.
+   * @param records The records, which are modified in place.
+   * @param factors The factor for each field.
+   */
+  static constexpr void Apply(std::span<Record> records,
+                              const Factors& factors) noexcept {
+    for (auto& record : records) {
+      ApplyToRecord(record, factors, std::index_sequence_for<Fields...>{});
+    }
+  }
+
+  /**
+   * @brief Writes every scalar component of the listed fields, multiplied by
+   * its factor, into a separate column.
+   *
+   * @details Columns are ordered as the fields are listed, with the
+   * components of array members adjacent. Each column must hold at least as
+   * many elements as there are records.
+   *
+   * @param records The records to be read.
+   * @param factors The factor for each field.
+   * @param columns The destination for each scalar component.
+   */
+  static constexpr void Transpose(std::span<const Record> records,
+                                  const Factors& factors,
+                                  const Columns& columns) noexcept {
+    for ([[maybe_unused]] const auto& column : columns) {
+      assert(column.size() >= records.size());
+    }
+    TransposeFields(records, factors, columns,
+                    std::index_sequence_for<Fields...>{});
+  }
+
+ private:
+  template <std::size_t... I>
+  static constexpr void ApplyToRecord(Record& record, const Factors& factors,
+                                      std::index_sequence<I...>) noexcept {
+    (ApplyToField<Fields>(record, factors[I]), ...);
+  }
+
+  template <typename Field>
+  static constexpr void ApplyToField(Record& record, Real factor) noexcept {
+    auto& member = record.*Field::Pointer;
+    for (std::size_t k = 0; k < Field::Extent; ++k) {
+      Field::Traits::Component(member, k) *= factor;
+    }
+  }
+
+  // The starting column of each field.
+  static constexpr std::array<std::size_t, FieldCount> Offsets() noexcept {
+    auto offsets = std::array<std::size_t, FieldCount>{};
+    auto extents = std::array<std::size_t, FieldCount>{Fields::Extent...};
+    for (std::size_t i = 1; i < FieldCount; ++i) {
+      offsets[i] = offsets[i - 1] + extents[i - 1];
+    }
+    return offsets;
+  }
+
+  template <std::size_t... I>
+  static constexpr void TransposeFields(std::span<const Record> records,
+                                        const Factors& factors,
+                                        const Columns& columns,
+                                        std::index_sequence<I...>) noexcept {
+    (TransposeField<Fields>(records, factors[I], columns, Offsets()[I]), ...);
+  }
+
+  // Each field is gathered in its own loop so that every inner loop writes
+  // to a single contiguous column.
+  template <typename Field>
+  static constexpr void TransposeField(std::span<const Record> records,
+                                       Real factor, const Columns& columns,
+                                       std::size_t offset) noexcept {
+    for (std::size_t k = 0; k < Field::Extent; ++k) {
+      auto* column = columns[offset + k].data();
+      for (std::size_t i = 0; i < records.size(); ++i) {
+        column[i] =
+            Field::Traits::Component(records[i].*Field::Pointer, k) * factor;
+      }
+    }
+  }
+};
+
+/**
+ * @brief Converts every listed field of an array of records to
+ * nondimensional form in place.
+ * @tparam Layout A specialisation of `RecordLayout`.
+ * @param system The unit system.
+ * @param records The records to be converted.
+ */
+template <typename Layout, typename System>
+constexpr void Nondimensionalise(
+    const System& system,
+    std::span<typename Layout::RecordType> records) noexcept {
+  Layout::Apply(records, Layout::InverseScales(system));
+}
+
+/**
+ * @brief Converts every listed field of an array of records to dimensional
+ * form in place.
+ * @tparam Layout A specialisation of `RecordLayout`.
+ * @param system The unit system.
+ * @param records The records to be converted.
+ */
+template <typename Layout, typename System>
+constexpr void Redimensionalise(
+    const System& system,
+    std::span<typename Layout::RecordType> records) noexcept {
+  Layout::Apply(records, Layout::Scales(system));
+}
+
+}  // namespace Dimensions
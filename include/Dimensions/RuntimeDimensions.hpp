@@ -0,0 +1,260 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/ScaleTable.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file RuntimeDimensions.hpp
+ * @brief Unit systems whose base scales are chosen when the program runs.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A `RuntimeDimensions` is built from base scales supplied at
+ * runtime, for example parsed from a configuration file, and serves every
+ * scale from a precomputed `ScaleTable`. Code that benefits from compile-time
+ * factors can be instantiated for a list of common presets with
+ * `DispatchOnPreset`, so that the table-driven path is only taken for systems
+ * that match none of them.
+ */
+
+namespace Dimensions {
+
+namespace Detail {
+
+/** @brief Removes leading and trailing spaces and tabs. */
+inline std::string_view Trim(std::string_view text) noexcept {
+  const auto first = text.find_first_not_of(" \t\r");
+  if (first == std::string_view::npos) return {};
+  const auto last = text.find_last_not_of(" \t\r");
+  return text.substr(first, last - first + 1);
+}
+
+/** @brief Parses a positive, finite scale, throwing on failure. */
+template <NumericConcepts::Real Real>
+Real ParseScale(std::string_view key, std::string_view text) {
+  auto value = Real{};
+  const auto [end, error] =
+      std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc{} || end != text.data() + text.size() ||
+      !(value > 0) || !(value <= std::numeric_limits<Real>::max())) {
+    throw std::runtime_error("Invalid value for " + std::string(key) + ": '" +
+                             std::string(text) + "'.");
+  }
+  return value;
+}
+
+}  // namespace Detail
+
+/**
+ * @brief A unit system whose base scales are supplied at runtime.
+ *
+ * @details All derived scales and dimensionless constants are evaluated once,
+ * on construction, and every accessor is then a load from the underlying
+ * `ScaleTable`. The class exposes the full `Dimensions` interface, so it can
+ * be passed to any function templated on the unit system.
+ *
+ * @tparam Real The numeric type for calculations. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <NumericConcepts::Real Real = double>
+class RuntimeDimensions : public CachedDimensions<Real> {
+ public:
+  /**
+   * @brief Constructs the system from its base scales.
+   * @param constants The length, density, time and temperature scales.
+   */
+  explicit constexpr RuntimeDimensions(
+      const SystemConstants<Real>& constants) noexcept
+      : CachedDimensions<Real>(Detail::RuntimeBaseScales<Real>(constants)) {}
+
+  /**
+   * @brief Constructs the system from length, mass and time scales, with an
+   * optional temperature scale.
+   *
+   * @details The density scale is formed as `MechanicalMassDimensions` forms
+   * it, so the result compares equal to a compile-time system built on that
+   * helper with the same scales.
+   *
+   * @param length The length scale.
+   * @param mass The mass scale.
+   * @param time The time scale.
+   * @param temperature The temperature scale.
+   * @return The unit system.
+   */
+  static constexpr RuntimeDimensions FromMass(Real length, Real mass,
+                                              Real time,
+                                              Real temperature = 1) noexcept {
+    using Extended = typename Detail::ExtendedPrecision<Real>::type;
+    const auto density = Detail::PowerProduct<Extended, -3, 1, 0, 0>(
+        static_cast<Extended>(length), static_cast<Extended>(mass),
+        Extended{1}, Extended{1});
+    return RuntimeDimensions({.lengthScale = length,
+                              .densityScale = static_cast<Real>(density),
+                              .timeScale = time,
+                              .temperatureScale = temperature});
+  }
+
+  /**
+   * @brief Builds a system from the text of a configuration file.
+   *
+   * @details Each non-empty line has the form `key = value`, and text after
+   * a `#` is ignored. The keys `length`, `time` and one of `density` or
+   * `mass` are required, and `temperature` defaults to one. Unknown keys,
+   * repeated keys, and values that are not positive finite numbers cause
+   * `std::runtime_error` to be thrown.
+   *
+   * @param text The configuration.
+   * @return The unit system.
+   */
+  static RuntimeDimensions FromConfig(std::string_view text) {
+    auto length = std::optional<Real>();
+    auto density = std::optional<Real>();
+    auto mass = std::optional<Real>();
+    auto time = std::optional<Real>();
+    auto temperature = std::optional<Real>();
+    while (!text.empty()) {
+      const auto newline = text.find('\n');
+      auto line = text.substr(0, newline);
+      text = newline == std::string_view::npos ? std::string_view()
+                                               : text.substr(newline + 1);
+      line = Detail::Trim(line.substr(0, line.find('#')));
+      if (line.empty()) continue;
+      const auto equals = line.find('=');
+      if (equals == std::string_view::npos) {
+        throw std::runtime_error("Expected 'key = value', found '" +
+                                 std::string(line) + "'.");
+      }
+      const auto key = Detail::Trim(line.substr(0, equals));
+      const auto value = Detail::Trim(line.substr(equals + 1));
+      auto* slot = key == "length"        ? &length
+                   : key == "density"     ? &density
+                   : key == "mass"        ? &mass
+                   : key == "time"        ? &time
+                   : key == "temperature" ? &temperature
+                                          : nullptr;
+      if (slot == nullptr) {
+        throw std::runtime_error("Unknown key '" + std::string(key) + "'.");
+      }
+      if (slot->has_value()) {
+        throw std::runtime_error("Repeated key '" + std::string(key) + "'.");
+      }
+      *slot = Detail::ParseScale<Real>(key, value);
+    }
+    if (!length || !time || density.has_value() == mass.has_value()) {
+      throw std::runtime_error(
+          "A configuration needs length, time, and one of density or mass.");
+    }
+    const auto theta = temperature.value_or(1);
+    if (mass) return FromMass(*length, *mass, *time, theta);
+    return RuntimeDimensions({.lengthScale = *length,
+                              .densityScale = *density,
+                              .timeScale = *time,
+                              .temperatureScale = theta});
+  }
+
+  /**
+   * @brief Builds a system by reading a configuration from a stream.
+   * @param in The stream holding the configuration.
+   * @return The unit system.
+   */
+  static RuntimeDimensions FromConfig(std::istream& in) {
+    const auto text = std::string(std::istreambuf_iterator<char>(in), {});
+    return FromConfig(std::string_view(text));
+  }
+};
+
+/**
+ * @brief The SI system, in which every base scale is one.
+ *
+ * @details This is the natural first preset for `DispatchOnPreset`.
+ *
+ * @tparam Real The numeric type for calculations.
+ */
+template <NumericConcepts::Real Real = double>
+class SIDimensions : public Dimensions<SIDimensions<Real>, Real> {
+ public:
+  constexpr Real LengthScale() const noexcept { return 1; }
+  constexpr Real DensityScale() const noexcept { return 1; }
+  constexpr Real TimeScale() const noexcept { return 1; }
+  constexpr Real TemperatureScale() const noexcept { return 1; }
+};
+
+/**
+ * @brief Calls `f` with the first preset whose base scales equal those of
+ * `system`, or with `system` itself if there is none.
+ *
+ * @details This lets a kernel that is templated on the unit system be
+ * instantiated once for each common preset, where all of its factors are
+ * compile-time constants, with the table-driven runtime system as the
+ * fallback:
+ *
+ * \code{.cpp}
+ * DispatchOnPreset<SIDimensions<>, EarthSystem>(system, [&](const auto& s) {
+ *   s.Redimensionalise(field, QuantityKind::Velocity);
+ * });
+ * \endcode
+ *
+ * Base scales are compared exactly. Every call of `f` must return the same
+ * type.
+ *
+ * @tparam Presets Default-constructible compile-time unit systems.
+ * @param system The runtime unit system.
+ * @param f A callable accepting any of the unit systems.
+ * @return The result of `f`.
+ */
+template <CompileTimeSystem... Presets, NumericConcepts::Real Real,
+          typename Function>
+auto DispatchOnPreset(const RuntimeDimensions<Real>& system, Function&& f)
+    -> std::invoke_result_t<Function&, const RuntimeDimensions<Real>&> {
+  using Result =
+      std::invoke_result_t<Function&, const RuntimeDimensions<Real>&>;
+  static_assert(
+      (std::is_same_v<std::invoke_result_t<Function&, const Presets&>,
+                      Result> &&
+       ...),
+      "The callable must return the same type for every unit system.");
+  const auto constants = system.Constants();
+  if constexpr (std::is_void_v<Result>) {
+    const auto matched = ((constants == Presets{}.Constants()
+                               ? (f(Presets{}), true)
+                               : false) ||
+                          ...);
+    if (!matched) f(system);
+  } else {
+    auto result = std::optional<Result>();
+    static_cast<void>(
+        ((constants == Presets{}.Constants()
+              ? (result.emplace(f(Presets{})), true)
+              : false) ||
+         ...));
+    if (result) return std::move(*result);
+    return f(system);
+  }
+}
+
+}  // namespace Dimensions
+
+/**
+ * @brief Declares or defines the explicit instantiations of
+ * `RuntimeDimensions` for one numeric type.
+ */
+#define DIMENSIONS_INSTANTIATE_RUNTIME_DIMENSIONS(Instantiation, Real) \
+  Instantiation class Dimensions::RuntimeDimensions<Real>;
+
+#if defined(DIMENSIONS_EXTERN_TEMPLATES)
+DIMENSIONS_INSTANTIATE_RUNTIME_DIMENSIONS(extern template, float)
+DIMENSIONS_INSTANTIATE_RUNTIME_DIMENSIONS(extern template, double)
+#endif
@@ -0,0 +1,540 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Portability.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file ScaleTable.hpp
+ * @brief Precomputed tables of scaling factors for a unit system.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ */
+
+namespace Dimensions {
+
+/**
+ * @brief The alignment used for precomputed scale tables.
+ *
+ * @details Tables are aligned to a typical cache-line size so that all
+ * factors for a unit system can be fetched with as few loads as possible.
+ */
+inline constexpr std::size_t ScaleTableAlignment = 64;
+
+/**
+ * @brief A snapshot of every base scale, derived scale and dimensionless
+ * constant of a unit system.
+ *
+ * @details All values are evaluated once at construction through the
+ * accessors of the source system and stored contiguously. The table is a
+ * plain aggregate, so it is trivially copyable and can be embedded in other
+ * objects, passed by value to kernels, or copied into GPU constant memory.
+ *
+ * @tparam Real The numeric type for the stored factors. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <NumericConcepts::Real Real = double>
+struct alignas(ScaleTableAlignment) ScaleTable {
+  /** @name Base Scales
+   * @{
+   */
+  Real lengthScale;
+  Real densityScale;
+  Real timeScale;
+  Real temperatureScale;
+  /** @} */
+
+  /** @name Derived Scales
+   * @{
+   */
+  Real massScale;
+  Real velocityScale;
+  Real accelerationScale;
+  Real forceScale;
+  Real tractionScale;
+  Real momentScale;
+  Real potentialScale;
+  Real energyScale;
+  Real heatFluxScale;
+  Real thermalConductivityScale;
+  Real specificHeatScale;
+  Real entropyScale;
+  /** @} */
+
+  /** @name Reciprocal Scales
+   * @brief The reciprocals of the base and derived scales, used when
+   * nondimensionalising so that no division is needed.
+   * @{
+   */
+  Real inverseLengthScale;
+  Real inverseDensityScale;
+  Real inverseTimeScale;
+  Real inverseTemperatureScale;
+  Real inverseMassScale;
+  Real inverseVelocityScale;
+  Real inverseAccelerationScale;
+  Real inverseForceScale;
+  Real inverseTractionScale;
+  Real inverseMomentScale;
+  Real inversePotentialScale;
+  Real inverseEnergyScale;
+  Real inverseHeatFluxScale;
+  Real inverseThermalConductivityScale;
+  Real inverseSpecificHeatScale;
+  Real inverseEntropyScale;
+  /** @} */
+
+  /** @name Dimensionless Constants
+   * @{
+   */
+  Real gravitationalConstant;
+  Real boltzmannConstant;
+  /** @} */
+};
+
+static_assert(std::is_trivially_copyable_v<ScaleTable<double>> &&
+              std::is_standard_layout_v<ScaleTable<double>>);
+
+/**
+ * @brief Builds a `ScaleTable` from any unit system.
+ *
+ * @details Each entry is computed through the corresponding accessor of the
+ * system, and hence takes into account any scales that have been redefined
+ * by intermediate helper classes such as `MechanicalMassDimensions`.
+ *
+ * @tparam System The concrete unit-system class.
+ * @param system The unit system to be evaluated.
+ * @return The table of precomputed factors.
+ */
+template <typename System>
+constexpr auto MakeScaleTable(const System& system) noexcept {
+  using Real = std::remove_cvref_t<decltype(system.LengthScale())>;
+  return ScaleTable<Real>{
+      .lengthScale = system.LengthScale(),
+      .densityScale = system.DensityScale(),
+      .timeScale = system.TimeScale(),
+      .temperatureScale = system.TemperatureScale(),
+      .massScale = system.MassScale(),
+      .velocityScale = system.VelocityScale(),
+      .accelerationScale = system.AccelerationScale(),
+      .forceScale = system.ForceScale(),
+      .tractionScale = system.TractionScale(),
+      .momentScale = system.MomentScale(),
+      .potentialScale = system.PotentialScale(),
+      .energyScale = system.EnergyScale(),
+      .heatFluxScale = system.HeatFluxScale(),
+      .thermalConductivityScale = system.ThermalConductivityScale(),
+      .specificHeatScale = system.SpecificHeatScale(),
+      .entropyScale = system.EntropyScale(),
+      .inverseLengthScale = system.template InverseScale<Length>(),
+      .inverseDensityScale = system.template InverseScale<Density>(),
+      .inverseTimeScale = system.template InverseScale<Time>(),
+      .inverseTemperatureScale = system.template InverseScale<Temperature>(),
+      .inverseMassScale = system.template InverseScale<Mass>(),
+      .inverseVelocityScale = system.template InverseScale<Velocity>(),
+      .inverseAccelerationScale =
+          system.template InverseScale<Acceleration>(),
+      .inverseForceScale = system.template InverseScale<Force>(),
+      .inverseTractionScale = system.template InverseScale<Traction>(),
+      .inverseMomentScale = system.template InverseScale<Moment>(),
+      .inversePotentialScale = system.template InverseScale<Potential>(),
+      .inverseEnergyScale = system.template InverseScale<Energy>(),
+      .inverseHeatFluxScale = system.template InverseScale<HeatFlux>(),
+      .inverseThermalConductivityScale =
+          system.template InverseScale<ThermalConductivity>(),
+      .inverseSpecificHeatScale =
+          system.template InverseScale<SpecificHeat>(),
+      .inverseEntropyScale = system.template InverseScale<Entropy>(),
+      .gravitationalConstant = system.GravitationalConstant(),
+      .boltzmannConstant = system.BoltzmannConstant()};
+}
+
+/**
+ * @brief Returns the scale of a quantity selected at runtime from a table.
+ *
+ * @details This depends only on the table, and so may be called from device
+ * code with a table passed as a kernel argument.
+ *
+ * @param table The table of factors.
+ * @param kind The physical quantity.
+ * @return The corresponding scaling factor.
+ */
+template <NumericConcepts::Real Real>
+DIMENSIONS_HOST_DEVICE constexpr Real TableScale(const ScaleTable<Real>& table,
+                                                 QuantityKind kind) noexcept {
+  switch (kind) {
+    case QuantityKind::Length:
+      return table.lengthScale;
+    case QuantityKind::Density:
+      return table.densityScale;
+    case QuantityKind::Time:
+      return table.timeScale;
+    case QuantityKind::Temperature:
+      return table.temperatureScale;
+    case QuantityKind::Mass:
+      return table.massScale;
+    case QuantityKind::Velocity:
+      return table.velocityScale;
+    case QuantityKind::Acceleration:
+      return table.accelerationScale;
+    case QuantityKind::Force:
+      return table.forceScale;
+    case QuantityKind::Traction:
+      return table.tractionScale;
+    case QuantityKind::Moment:
+      return table.momentScale;
+    case QuantityKind::Potential:
+      return table.potentialScale;
+    case QuantityKind::Energy:
+      return table.energyScale;
+    case QuantityKind::HeatFlux:
+      return table.heatFluxScale;
+    case QuantityKind::ThermalConductivity:
+      return table.thermalConductivityScale;
+    case QuantityKind::SpecificHeat:
+      return table.specificHeatScale;
+    case QuantityKind::Entropy:
+      return table.entropyScale;
+  }
+  return static_cast<Real>(1);
+}
+
+/**
+ * @brief Returns the reciprocal scale of a quantity selected at runtime from
+ * a table.
+ * @param table The table of factors.
+ * @param kind The physical quantity.
+ * @return The corresponding reciprocal scaling factor.
+ */
+template <NumericConcepts::Real Real>
+DIMENSIONS_HOST_DEVICE constexpr Real TableInverseScale(
+    const ScaleTable<Real>& table, QuantityKind kind) noexcept {
+  switch (kind) {
+    case QuantityKind::Length:
+      return table.inverseLengthScale;
+    case QuantityKind::Density:
+      return table.inverseDensityScale;
+    case QuantityKind::Time:
+      return table.inverseTimeScale;
+    case QuantityKind::Temperature:
+      return table.inverseTemperatureScale;
+    case QuantityKind::Mass:
+      return table.inverseMassScale;
+    case QuantityKind::Velocity:
+      return table.inverseVelocityScale;
+    case QuantityKind::Acceleration:
+      return table.inverseAccelerationScale;
+    case QuantityKind::Force:
+      return table.inverseForceScale;
+    case QuantityKind::Traction:
+      return table.inverseTractionScale;
+    case QuantityKind::Moment:
+      return table.inverseMomentScale;
+    case QuantityKind::Potential:
+      return table.inversePotentialScale;
+    case QuantityKind::Energy:
+      return table.inverseEnergyScale;
+    case QuantityKind::HeatFlux:
+      return table.inverseHeatFluxScale;
+    case QuantityKind::ThermalConductivity:
+      return table.inverseThermalConductivityScale;
+    case QuantityKind::SpecificHeat:
+      return table.inverseSpecificHeatScale;
+    case QuantityKind::Entropy:
+      return table.inverseEntropyScale;
+  }
+  return static_cast<Real>(1);
+}
+
+namespace Detail {
+
+/**
+ * @brief Returns true, and is a constant expression only if every entry of
+ * the scale table of `System` can be evaluated at compile time.
+ */
+template <typename System>
+constexpr bool FoldsAtCompileTime() noexcept {
+  return (static_cast<void>(MakeScaleTable(System{})), true);
+}
+
+/** @brief The number of quantities whose scales are held in a table. */
+inline constexpr std::size_t TableKindCount =
+    static_cast<std::size_t>(QuantityKind::Entropy) + 1;
+
+/**
+ * @brief Returns the index of the quantity with dimension L^L M^M T^T Θ^Theta,
+ * or -1 if no quantity in the table has that dimension.
+ */
+template <int L, int M, int T, int Theta, std::size_t... I>
+constexpr int TableEntry(std::index_sequence<I...>) noexcept {
+  constexpr auto matches = []<typename Dim>(Dim) {
+    return Dim::Length == L && Dim::Mass == M && Dim::Time == T &&
+           Dim::Temperature == Theta;
+  };
+  auto entry = -1;
+  const auto visit = [&](std::size_t i, bool match) {
+    if (match) entry = static_cast<int>(i);
+  };
+  (visit(I, matches(::Dimensions::DimensionOf<static_cast<QuantityKind>(I)>{})),
+   ...);
+  return entry;
+}
+
+/** @brief The table index of the dimension L^L M^M T^T Θ^Theta, or -1. */
+template <int L, int M, int T, int Theta>
+inline constexpr int TableIndex = TableEntry<L, M, T, Theta>(
+    std::make_index_sequence<TableKindCount>{});
+
+}  // namespace Detail
+
+/**
+ * @brief Concept satisfied by unit systems whose scales are all compile-time
+ * constants.
+ *
+ * @details A system satisfies the concept if it is default constructible and
+ * every base scale, derived scale and dimensionless constant can be evaluated
+ * in a constant expression. A single accessor that is not `constexpr`, in the
+ * final class or in any helper it relies on, causes the concept to fail, so
+ * `static_assert(CompileTimeSystem<MySystem>)` guarantees that every factor
+ * folds to an immediate.
+ */
+template <typename System>
+concept CompileTimeSystem =
+    std::is_default_constructible_v<System> && requires {
+      typename std::bool_constant<Detail::FoldsAtCompileTime<System>()>;
+    };
+
+/**
+ * @brief Evaluates the scale table of a compile-time system.
+ *
+ * @details Being `consteval`, this cannot silently fall back to runtime
+ * evaluation.
+ *
+ * @tparam System A compile-time unit system.
+ * @return The table of factors.
+ */
+template <CompileTimeSystem System>
+consteval auto CompileTimeScaleTable() noexcept {
+  return MakeScaleTable(System{});
+}
+
+/**
+ * @brief The scale table of a compile-time system as a `constexpr` variable.
+ *
+ * @details Its entries are constant expressions, and so may be used as
+ * non-type template arguments, e.g.
+ * `Kernel<StaticScaleTable<MySystem>.tractionScale>()`.
+ */
+template <CompileTimeSystem System>
+inline constexpr auto StaticScaleTable = CompileTimeScaleTable<System>();
+
+/**
+ * @brief A unit system whose scales are all served from a precomputed table.
+ *
+ * @details This class is intended for unit systems whose base scales are only
+ * known at runtime. Constructing a `CachedDimensions` from such a system
+ * evaluates every derived scale and dimensionless constant once, after which
+ * each accessor is a single load. The accessors shadow those of the
+ * `Dimensions` base, so code that is templated on the concrete system type
+ * never re-evaluates the chains of multiplications and divisions.
+ *
+ * @tparam Real The numeric type for calculations. Must satisfy the
+ * `NumericConcepts::Real` concept.
+ */
+template <NumericConcepts::Real Real = double>
+class CachedDimensions : public Dimensions<CachedDimensions<Real>, Real> {
+ public:
+  /**
+   * @brief Constructs the cache from an existing table.
+   * @param table The table of precomputed factors.
+   */
+  explicit constexpr CachedDimensions(const ScaleTable<Real>& table) noexcept
+      : table_{table} {}
+
+  /**
+   * @brief Constructs the cache by evaluating a unit system.
+   * @tparam Derived_ The concrete class of the source unit system.
+   * @param system The unit system to be evaluated.
+   */
+  template <typename Derived_>
+  explicit constexpr CachedDimensions(
+      const Dimensions<Derived_, Real>& system) noexcept
+      : table_{MakeScaleTable(static_cast<const Derived_&>(system))} {}
+
+  /** @brief Returns the underlying table of factors. */
+  DIMENSIONS_HOST_DEVICE constexpr const auto& Table() const noexcept {
+    return table_;
+  }
+
+  /** @name Base Scales
+   * @{
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto LengthScale() const noexcept {
+    return table_.lengthScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto DensityScale() const noexcept {
+    return table_.densityScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto TimeScale() const noexcept {
+    return table_.timeScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto TemperatureScale() const noexcept {
+    return table_.temperatureScale;
+  }
+  /** @} */
+
+  /** @name Derived Scales and Dimensionless Constants
+   * @{
+   */
+  DIMENSIONS_HOST_DEVICE constexpr auto GravitationalConstant() const noexcept {
+    return table_.gravitationalConstant;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto BoltzmannConstant() const noexcept {
+    return table_.boltzmannConstant;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto MassScale() const noexcept {
+    return table_.massScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto VelocityScale() const noexcept {
+    return table_.velocityScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto AccelerationScale() const noexcept {
+    return table_.accelerationScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto ForceScale() const noexcept {
+    return table_.forceScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto TractionScale() const noexcept {
+    return table_.tractionScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto MomentScale() const noexcept {
+    return table_.momentScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto PotentialScale() const noexcept {
+    return table_.potentialScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto EnergyScale() const noexcept {
+    return table_.energyScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto HeatFluxScale() const noexcept {
+    return table_.heatFluxScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto ThermalConductivityScale()
+      const noexcept {
+    return table_.thermalConductivityScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto SpecificHeatScale() const noexcept {
+    return table_.specificHeatScale;
+  }
+  DIMENSIONS_HOST_DEVICE constexpr auto EntropyScale() const noexcept {
+    return table_.entropyScale;
+  }
+  /** @} */
+
+  using Dimensions<CachedDimensions<Real>, Real>::Scale;
+  using Dimensions<CachedDimensions<Real>, Real>::InverseScale;
+
+  /**
+   * @brief Returns the scaling factor for the dimension L^L M^M T^T Θ^Theta.
+   *
+   * @details Dimensions held in the table, and their reciprocals, are served
+   * from it, so that this agrees with the named accessors and the runtime
+   * overloads; any other dimension is evaluated from the cached base scales.
+   *
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The scaling factor.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Real Scale() const noexcept {
+    if constexpr (constexpr auto index = Detail::TableIndex<L, M, T, Theta>;
+                  index >= 0) {
+      return TableScale(table_, static_cast<QuantityKind>(index));
+    } else if constexpr (constexpr auto inverse =
+                             Detail::TableIndex<-L, -M, -T, -Theta>;
+                         inverse >= 0) {
+      return TableInverseScale(table_, static_cast<QuantityKind>(inverse));
+    } else {
+      return Dimensions<CachedDimensions<Real>, Real>::template Scale<
+          L, M, T, Theta>();
+    }
+  }
+
+  /**
+   * @brief Returns the scaling factor for a `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The scaling factor.
+   */
+  template <PhysicalDimension Dim>
+  DIMENSIONS_HOST_DEVICE constexpr Real Scale() const noexcept {
+    return Scale<Dim::Length, Dim::Mass, Dim::Time, Dim::Temperature>();
+  }
+
+
+  /**
+   * @brief Returns the reciprocal scaling factor for the dimension
+   * L^L M^M T^T Θ^Theta, from the table where it holds the dimension.
+   * @tparam L The exponent of length.
+   * @tparam M The exponent of mass.
+   * @tparam T The exponent of time.
+   * @tparam Theta The exponent of temperature.
+   * @return The reciprocal scaling factor.
+   */
+  template <int L, int M, int T, int Theta = 0>
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale() const noexcept {
+    return Scale<-L, -M, -T, -Theta>();
+  }
+
+  /**
+   * @brief Returns the reciprocal scaling factor for a `Dimension` type.
+   * @tparam Dim The physical dimension.
+   * @return The reciprocal scaling factor.
+   */
+  template <PhysicalDimension Dim>
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale() const noexcept {
+    return Scale<DimensionInverse<Dim>>();
+  }
+
+  /**
+   * @brief Returns the cached reciprocal scale for a quantity selected at
+   * runtime.
+   * @param kind The physical quantity.
+   * @return The corresponding reciprocal scaling factor.
+   */
+  DIMENSIONS_HOST_DEVICE constexpr Real InverseScale(
+      QuantityKind kind) const noexcept {
+    return TableInverseScale(table_, kind);
+  }
+
+ private:
+  ScaleTable<Real> table_;
+};
+
+/**
+ * @brief Deduction guide allowing `CachedDimensions(system)`.
+ */
+template <typename Derived_, typename Real>
+CachedDimensions(const Dimensions<Derived_, Real>&) -> CachedDimensions<Real>;
+
+}  // namespace Dimensions
+
+/**
+ * @brief Declares or defines the explicit instantiations of
+ * `CachedDimensions` for one numeric type.
+ */
+#define DIMENSIONS_INSTANTIATE_CACHED_DIMENSIONS(Instantiation, Real) \
+  Instantiation class Dimensions::Dimensions<                          \
+      Dimensions::CachedDimensions<Real>, Real>;                       \
+  Instantiation class Dimensions::CachedDimensions<Real>;
+
+#if defined(DIMENSIONS_EXTERN_TEMPLATES)
+DIMENSIONS_INSTANTIATE_CACHED_DIMENSIONS(extern template, float)
+DIMENSIONS_INSTANTIATE_CACHED_DIMENSIONS(extern template, double)
+#endif
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file ScratchArena.hpp
+ * @brief Reusable aligned storage for transient scaled copies of fields.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details A `ScratchArena` hands out aligned buffers by bumping an offset
+ * through memory it owns, and `Reset` makes all of that memory available
+ * again without returning it. If a step needs more than the arena holds,
+ * further chunks are allocated, and the next `Reset` replaces them with one
+ * chunk of the combined size. After the first steps of a repeated workload,
+ * such as writing the same set of fields at every output step, no further
+ * allocations are made:
+ *
+ * \code{.cpp}
+ * auto arena = Dimensions::ScratchArena();
+ * for (auto step = 0; step < steps; ++step) {
+ *   const auto v = Dimensions::Redimensionalise(system, velocity,
+ *                                               QuantityKind::Velocity,
+ *                                               arena);
+ *   writer.Write(v);
+ *   arena.Reset();
+ * }
+ * \endcode
+ *
+ * On systems with a first-touch page placement policy, as Linux has by
+ * default, memory is placed on the NUMA node of the thread that first
+ * writes to it. An arena should therefore be owned by the thread that fills
+ * its buffers, and `Reserve` can be used to place the memory up front. The
+ * arena is also a `std::pmr::memory_resource`, so standard containers can
+ * draw from it. It is not thread-safe.
+ */
+
+namespace Dimensions {
+
+/** @brief The alignment, in bytes, of every buffer handed out by an arena. */
+inline constexpr std::size_t ScratchAlignment = 64;
+
+/**
+ * @brief A monotonic arena of aligned scratch memory that is recycled by
+ * `Reset`.
+ */
+class ScratchArena : public std::pmr::memory_resource {
+ public:
+  /**
+   * @brief Constructs an arena, optionally with an initial capacity.
+   * @param bytes The initial capacity, which is allocated but not touched.
+   */
+  explicit ScratchArena(std::size_t bytes = 0) {
+    if (bytes > 0) AddChunk(bytes);
+  }
+
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+
+  ~ScratchArena() override { Release(); }
+
+  /**
+   * @brief Returns an uninitialised, aligned buffer of `count` elements that
+   * remains valid until the next `Reset`.
+   * @param count The number of elements.
+   */
+  template <typename T>
+  std::span<T> Allocate(std::size_t count) {
+    static_assert(alignof(T) <= ScratchAlignment);
+    if (count == 0) return {};
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    return {static_cast<T*>(Bump(count * sizeof(T))), count};
+  }
+
+  /**
+   * @brief Makes all memory available for reuse, invalidating every buffer
+   * handed out so far.
+   *
+   * @details If the arena holds several chunks they are replaced by a single
+   * chunk of the combined capacity, so that a step of the same size as the
+   * last is served without allocating.
+   */
+  void Reset() {
+    if (chunks_.size() > 1) {
+      const auto capacity = Capacity();
+      Release();
+      AddChunk(capacity);
+    }
+    current_ = 0;
+    offset_ = 0;
+    used_ = 0;
+  }
+
+  /**
+   * @brief Resets the arena, ensures that at least `bytes` can then be handed
+   * out without allocating, and places the memory on the caller's NUMA node
+   * by touching every page.
+   * @param bytes The capacity required.
+   */
+  void Reserve(std::size_t bytes) {
+    Reset();
+    if (Capacity() < bytes) {
+      Release();
+      AddChunk(bytes);
+    }
+    constexpr std::size_t page = 4096;
+    for (const auto& chunk : chunks_) {
+      for (std::size_t i = 0; i < chunk.size; i += page) chunk.data[i] = {};
+    }
+  }
+
+  /** @brief Returns the number of bytes owned by the arena. */
+  std::size_t Capacity() const noexcept {
+    auto capacity = std::size_t{0};
+    for (const auto& chunk : chunks_) capacity += chunk.size;
+    return capacity;
+  }
+
+  /** @brief Returns the number of bytes handed out since the last `Reset`. */
+  std::size_t Used() const noexcept { return used_; }
+
+  /** @brief Returns the number of chunks allocated over the arena's life. */
+  std::size_t ChunkAllocations() const noexcept { return chunkAllocations_; }
+
+ private:
+  struct Chunk {
+    std::byte* data;
+    std::size_t size;
+  };
+
+  std::vector<Chunk> chunks_;
+  std::size_t current_ = 0;
+  std::size_t offset_ = 0;
+  std::size_t used_ = 0;
+  std::size_t chunkAllocations_ = 0;
+
+  /** @brief Rounds up to the alignment, throwing if the result overflows. */
+  static constexpr std::size_t RoundUp(std::size_t bytes) {
+    if (bytes > std::numeric_limits<std::size_t>::max() - ScratchAlignment) {
+      throw std::bad_alloc();
+    }
+    return (bytes + ScratchAlignment - 1) / ScratchAlignment *
+           ScratchAlignment;
+  }
+
+  void AddChunk(std::size_t bytes) {
+    bytes = RoundUp(bytes);
+    // Reserve first, so that the insertion below cannot throw and leak the
+    // chunk.
+    chunks_.reserve(chunks_.size() + 1);
+    auto* data = static_cast<std::byte*>(
+        ::operator new(bytes, std::align_val_t{ScratchAlignment}));
+    chunks_.push_back({data, bytes});
+    ++chunkAllocations_;
+  }
+
+  void Release() noexcept {
+    for (const auto& chunk : chunks_) {
+      ::operator delete(chunk.data, std::align_val_t{ScratchAlignment});
+    }
+    chunks_.clear();
+    current_ = 0;
+    offset_ = 0;
+  }
+
+  void* Bump(std::size_t bytes) {
+    bytes = RoundUp(bytes);
+    while (current_ < chunks_.size() &&
+           chunks_[current_].size - offset_ < bytes) {
+      ++current_;
+      offset_ = 0;
+    }
+    if (current_ == chunks_.size()) {
+      // Grow geometrically so that the number of chunks stays small.
+      AddChunk(std::max(bytes, Capacity()));
+      offset_ = 0;
+    }
+    auto* data = chunks_[current_].data + offset_;
+    offset_ += bytes;
+    used_ += bytes;
+    return data;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    if (alignment > ScratchAlignment) throw std::bad_alloc();
+    return Bump(std::max<std::size_t>(bytes, 1));
+  }
+
+  void do_deallocate(void*, std::size_t, std::size_t) noexcept override {}
+
+  bool do_is_equal(
+      const std::pmr::memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+};
+
+/**
+ * @brief Returns a dimensional copy of nondimensional values held in an
+ * arena.
+ * @param system The unit system.
+ * @param in The nondimensional data.
+ * @param kind The physical quantity that the data represents.
+ * @param arena The arena that holds the copy until its next `Reset`.
+ * @return The dimensional values.
+ */
+template <typename Derived_, NumericConcepts::Real Real>
+std::span<Real> Redimensionalise(
+    const Dimensions<Derived_, Real>& system,
+    std::type_identity_t<std::span<const Real>> in, QuantityKind kind,
+    ScratchArena& arena) {
+  const auto out = arena.Allocate<Real>(in.size());
+  static_cast<const Derived_&>(system).Redimensionalise(in, out, kind);
+  return out;
+}
+
+/**
+ * @brief Returns a nondimensional copy of dimensional values held in an
+ * arena.
+ * @param system The unit system.
+ * @param in The dimensional data.
+ * @param kind The physical quantity that the data represents.
+ * @param arena The arena that holds the copy until its next `Reset`.
+ * @return The nondimensional values.
+ */
+template <typename Derived_, NumericConcepts::Real Real>
+std::span<Real> Nondimensionalise(
+    const Dimensions<Derived_, Real>& system,
+    std::type_identity_t<std::span<const Real>> in, QuantityKind kind,
+    ScratchArena& arena) {
+  const auto out = arena.Allocate<Real>(in.size());
+  static_cast<const Derived_&>(system).Nondimensionalise(in, out, kind);
+  return out;
+}
+
+}  // namespace Dimensions
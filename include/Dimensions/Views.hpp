@@ -0,0 +1,126 @@
+#pragma once
+
+#include <ranges>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimension.hpp"
+#include "NumericConcepts/NumericConcepts.hpp"
+
+/**
+ * @file Views.hpp
+ * @brief Range adaptors that apply scaling factors lazily.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details Each adaptor evaluates its factor once, when it is created, and
+ * then multiplies elements as they are read. No scaled copy of the data is
+ * formed, so the adaptors can be piped directly into reductions, writers or
+ * interpolators:
+ *
+ * \code{.cpp}
+ * auto peak = std::ranges::max(
+ *     field | Dimensions::Views::Redimensionalise(system, kind));
+ * \endcode
+ *
+ * The adaptors are built on `std::views::transform`, so a view of a
+ * contiguous range is a sized, random-access range whose elements are
+ * computed by a single multiplication.
+ */
+
+namespace Dimensions::Views {
+
+namespace Detail {
+
+/**
+ * @brief Function object that multiplies its argument by a fixed factor.
+ */
+template <NumericConcepts::Real Real>
+struct Multiplier {
+  Real factor;
+
+  template <typename T>
+  constexpr auto operator()(const T& value) const noexcept {
+    return value * factor;
+  }
+};
+
+}  // namespace Detail
+
+/**
+ * @brief Returns an adaptor that multiplies each element by `factor`.
+ * @param factor The scaling factor.
+ */
+template <NumericConcepts::Real Real>
+constexpr auto Scale(Real factor) {
+  return std::views::transform(Detail::Multiplier<Real>{factor});
+}
+
+/**
+ * @brief Returns an adaptor that converts nondimensional values of a quantity
+ * to dimensional form.
+ * @param system The unit system.
+ * @param kind The physical quantity.
+ */
+template <typename System>
+constexpr auto Redimensionalise(const System& system, QuantityKind kind) {
+  return Scale(system.Scale(kind));
+}
+
+/**
+ * @brief Returns an adaptor that converts nondimensional values of a
+ * dimension to dimensional form.
+ * @tparam Dim The physical dimension.
+ * @param system The unit system.
+ */
+template <PhysicalDimension Dim, typename System>
+constexpr auto Redimensionalise(const System& system) {
+  return Scale(system.template Scale<Dim>());
+}
+
+/**
+ * @brief Returns an adaptor that converts dimensional values of a quantity
+ * to nondimensional form.
+ * @param system The unit system.
+ * @param kind The physical quantity.
+ */
+template <typename System>
+constexpr auto Nondimensionalise(const System& system, QuantityKind kind) {
+  return Scale(system.InverseScale(kind));
+}
+
+/**
+ * @brief Returns an adaptor that converts dimensional values of a dimension
+ * to nondimensional form.
+ * @tparam Dim The physical dimension.
+ * @param system The unit system.
+ */
+template <PhysicalDimension Dim, typename System>
+constexpr auto Nondimensionalise(const System& system) {
+  return Scale(system.template InverseScale<Dim>());
+}
+
+/**
+ * @brief Returns an adaptor that converts nondimensional values of a quantity
+ * between unit systems using the fused `ConversionFactor`.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ * @param kind The physical quantity.
+ */
+template <typename From, typename To>
+constexpr auto Convert(const From& from, const To& to, QuantityKind kind) {
+  return Scale(ConversionFactor(from, to, kind));
+}
+
+/**
+ * @brief Returns an adaptor that converts nondimensional values of a
+ * dimension between unit systems using the fused `ConversionFactor`.
+ * @tparam Dim The physical dimension.
+ * @param from The unit system in which the values are nondimensional.
+ * @param to The unit system into which the values are converted.
+ */
+template <PhysicalDimension Dim, typename From, typename To>
+constexpr auto Convert(const From& from, const To& to) {
+  return Scale(ConversionFactor<Dim>(from, to));
+}
+
+}  // namespace Dimensions::Views
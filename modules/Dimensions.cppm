@@ -0,0 +1,224 @@
+/**
+ * @file Dimensions.cppm
+ * @brief The `Dimensions` C++20 module interface unit.
+ * @author David Al-Attar
+ * @date 11 August 2025
+ *
+ * @details The module re-exports the public interface of the header-only
+ * library, so that `import Dimensions;` can replace the corresponding
+ * `#include`s. The standard library and `NumericConcepts` headers are parsed
+ * once, when the module is built, rather than in every translation unit. The
+ * optional `Parallel.hpp` and `Device.hpp` headers are not part of the module
+ * because they depend on TBB and CUDA respectively. The kernels declared in
+ * `Dispatch.hpp` are defined only in the `Dimensions::Dispatch` library.
+ * Macros, such as `DIMENSIONS_HAS_SIMD`, are not exported by modules.
+ */
+
+module;
+
+#include "Dimensions/Compensated.hpp"
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimension.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Dispatch.hpp"
+#include "Dimensions/DoubleWord.hpp"
+#include "Dimensions/Expressions.hpp"
+#include "Dimensions/FieldFile.hpp"
+#include "Dimensions/Instrumentation.hpp"
+#include "Dimensions/InstrumentationJson.hpp"
+#include "Dimensions/Kernels.hpp"
+#include "Dimensions/Pipeline.hpp"
+#include "Dimensions/Quantisation.hpp"
+#include "Dimensions/Quantity.hpp"
+#include "Dimensions/Records.hpp"
+#include "Dimensions/RuntimeDimensions.hpp"
+#include "Dimensions/ScaleTable.hpp"
+#include "Dimensions/ScratchArena.hpp"
+#include "Dimensions/SystemBatch.hpp"
+#include "Dimensions/Views.hpp"
+
+export module Dimensions;
+
+export namespace Dimensions {
+
+// Dimension.hpp
+using ::Dimensions::Acceleration;
+using ::Dimensions::Density;
+using ::Dimensions::Dimension;
+using ::Dimensions::Dimensionless;
+using ::Dimensions::DimensionInverse;
+using ::Dimensions::DimensionOf;
+using ::Dimensions::DimensionPower;
+using ::Dimensions::DimensionProduct;
+using ::Dimensions::DimensionQuotient;
+using ::Dimensions::Energy;
+using ::Dimensions::Entropy;
+using ::Dimensions::Force;
+using ::Dimensions::HeatFlux;
+using ::Dimensions::Length;
+using ::Dimensions::Mass;
+using ::Dimensions::Moment;
+using ::Dimensions::PhysicalDimension;
+using ::Dimensions::Potential;
+using ::Dimensions::QuantityKind;
+using ::Dimensions::SpecificHeat;
+using ::Dimensions::Temperature;
+using ::Dimensions::ThermalConductivity;
+using ::Dimensions::Time;
+using ::Dimensions::Traction;
+using ::Dimensions::Velocity;
+using ::Dimensions::VisitDimension;
+
+// Quantity.hpp
+using ::Dimensions::Quantity;
+using ::Dimensions::operator*;
+using ::Dimensions::operator/;
+
+// DoubleWord.hpp
+using ::Dimensions::DoubleWord;
+
+// Dimensions.hpp
+using ::Dimensions::ConstantDimensions;
+using ::Dimensions::Dimensions;
+using ::Dimensions::MechanicalDimensions;
+using ::Dimensions::MechanicalMassDimensions;
+using ::Dimensions::SystemConstants;
+using ::Dimensions::ThermalMassDimensions;
+
+// ScaleTable.hpp
+using ::Dimensions::CachedDimensions;
+using ::Dimensions::CompileTimeScaleTable;
+using ::Dimensions::CompileTimeSystem;
+using ::Dimensions::MakeScaleTable;
+using ::Dimensions::ScaleTable;
+using ::Dimensions::ScaleTableAlignment;
+using ::Dimensions::StaticScaleTable;
+using ::Dimensions::TableInverseScale;
+using ::Dimensions::TableScale;
+
+// Conversion.hpp, Records.hpp, Quantisation.hpp and ScratchArena.hpp
+using ::Dimensions::ConversionFactor;
+using ::Dimensions::Convert;
+using ::Dimensions::Dequantise;
+using ::Dimensions::Nondimensionalise;
+using ::Dimensions::Quantise;
+using ::Dimensions::Quantiser;
+using ::Dimensions::RecordField;
+using ::Dimensions::RecordLayout;
+using ::Dimensions::Redimensionalise;
+
+// SystemBatch.hpp
+using ::Dimensions::SystemBatch;
+
+// Pipeline.hpp
+using ::Dimensions::ConversionPipeline;
+using ::Dimensions::MakeConvertPipeline;
+using ::Dimensions::MakeNondimensionalisePipeline;
+using ::Dimensions::MakeRedimensionalisePipeline;
+
+// ScratchArena.hpp
+using ::Dimensions::ScratchAlignment;
+using ::Dimensions::ScratchArena;
+
+// RuntimeDimensions.hpp
+using ::Dimensions::DispatchOnPreset;
+using ::Dimensions::RuntimeDimensions;
+using ::Dimensions::SIDimensions;
+
+// FieldFile.hpp
+using ::Dimensions::FieldAlignment;
+using ::Dimensions::FieldElementType;
+using ::Dimensions::FieldFormatVersion;
+using ::Dimensions::FieldHeader;
+using ::Dimensions::FieldView;
+using ::Dimensions::MakeFieldHeader;
+#if DIMENSIONS_HAS_MMAP
+using ::Dimensions::MappedFile;
+#endif
+using ::Dimensions::WriteField;
+
+}  // namespace Dimensions
+
+export namespace Dimensions::Compensated {
+
+using ::Dimensions::Compensated::InverseScale;
+using ::Dimensions::Compensated::Nondimensionalise;
+using ::Dimensions::Compensated::Redimensionalise;
+using ::Dimensions::Compensated::Scale;
+
+}  // namespace Dimensions::Compensated
+
+export namespace Dimensions::Kernels {
+
+using ::Dimensions::Kernels::AsPackedReals;
+using ::Dimensions::Kernels::Dequantise;
+using ::Dimensions::Kernels::Multiply;
+using ::Dimensions::Kernels::MultiplyInterleaved;
+using ::Dimensions::Kernels::MultiplyStrided;
+#if DIMENSIONS_HAS_MDSPAN
+using ::Dimensions::Kernels::MultiplyComponents;
+#endif
+using ::Dimensions::Kernels::PackedReal;
+using ::Dimensions::Kernels::PackedScalar;
+using ::Dimensions::Kernels::Quantise;
+using ::Dimensions::Kernels::StorageReal;
+
+}  // namespace Dimensions::Kernels
+
+export namespace Dimensions::Dispatch {
+
+using ::Dimensions::Dispatch::ActiveTarget;
+using ::Dimensions::Dispatch::Dispatched;
+using ::Dimensions::Dispatch::Multiply;
+using ::Dimensions::Dispatch::Select;
+using ::Dimensions::Dispatch::Supported;
+using ::Dimensions::Dispatch::Target;
+using ::Dimensions::Dispatch::TargetName;
+
+}  // namespace Dimensions::Dispatch
+
+export namespace Dimensions::Expressions {
+
+using ::Dimensions::Expressions::BinaryExpression;
+using ::Dimensions::Expressions::CompatibleExpressions;
+using ::Dimensions::Expressions::ConstantExpression;
+using ::Dimensions::Expressions::Evaluate;
+using ::Dimensions::Expressions::Expression;
+using ::Dimensions::Expressions::Field;
+using ::Dimensions::Expressions::FieldExpression;
+using ::Dimensions::Expressions::NegateExpression;
+using ::Dimensions::Expressions::Nondimensionalise;
+using ::Dimensions::Expressions::QuantityFieldExpression;
+using ::Dimensions::Expressions::Redimensionalise;
+using ::Dimensions::Expressions::ValueForm;
+using ::Dimensions::Expressions::operator+;
+using ::Dimensions::Expressions::operator-;
+using ::Dimensions::Expressions::operator*;
+using ::Dimensions::Expressions::operator/;
+
+}  // namespace Dimensions::Expressions
+
+export namespace Dimensions::Instrumentation {
+
+using ::Dimensions::Instrumentation::Capture;
+using ::Dimensions::Instrumentation::Counters;
+using ::Dimensions::Instrumentation::Enabled;
+using ::Dimensions::Instrumentation::InterleavedSlot;
+using ::Dimensions::Instrumentation::KindCount;
+using ::Dimensions::Instrumentation::Reset;
+using ::Dimensions::Instrumentation::Slot;
+using ::Dimensions::Instrumentation::Snapshot;
+using ::Dimensions::Instrumentation::ToJson;
+using ::Dimensions::Instrumentation::Visit;
+using ::Dimensions::Instrumentation::WriteJson;
+
+}  // namespace Dimensions::Instrumentation
+
+export namespace Dimensions::Views {
+
+using ::Dimensions::Views::Convert;
+using ::Dimensions::Views::Nondimensionalise;
+using ::Dimensions::Views::Redimensionalise;
+using ::Dimensions::Views::Scale;
+
+}  // namespace Dimensions::Views
@@ -0,0 +1,344 @@
+/**
+ * @file Dispatch.cpp
+ * @brief Runtime-dispatched kernels for the `Dimensions::Dispatch` library.
+ *
+ * @details Each kernel is written once as a plain loop and compiled several
+ * times within this file, with the instruction set of each version enabled
+ * through a `target` attribute, so that the auto-vectoriser emits vectors of
+ * the corresponding width. Only the baseline version is executed until the
+ * processor has been queried.
+ */
+
+#include "Dimensions/Dispatch.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define DIMENSIONS_DISPATCH_X86 1
+#else
+#define DIMENSIONS_DISPATCH_X86 0
+#endif
+
+// The SVE version relies on the GCC spelling of the target attribute and on
+// the Linux auxiliary vector for detection.
+#if defined(__aarch64__) && defined(__GNUC__) && !defined(__clang__) && \
+    defined(__linux__) && __has_include(<sys/auxv.h>)
+#include <sys/auxv.h>
+#if defined(HWCAP_SVE)
+#define DIMENSIONS_DISPATCH_SVE 1
+#endif
+#endif
+#if !defined(DIMENSIONS_DISPATCH_SVE)
+#define DIMENSIONS_DISPATCH_SVE 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DIMENSIONS_DISPATCH_INLINE [[gnu::always_inline]] inline
+#else
+#define DIMENSIONS_DISPATCH_INLINE inline
+#endif
+
+namespace Dimensions::Dispatch {
+
+namespace {
+
+// The loops are inlined into each target-specific wrapper, and so are
+// vectorised for the instruction set of the wrapper.
+template <typename Real>
+DIMENSIONS_DISPATCH_INLINE void ScaleInPlace(Real* data, std::size_t size,
+                                             Real factor) noexcept {
+  for (std::size_t i = 0; i < size; ++i) data[i] *= factor;
+}
+
+template <typename Real>
+DIMENSIONS_DISPATCH_INLINE void ScaleInto(const Real* __restrict in,
+                                          Real* __restrict out,
+                                          std::size_t size,
+                                          Real factor) noexcept {
+  for (std::size_t i = 0; i < size; ++i) out[i] = in[i] * factor;
+}
+
+// With fused multiply-add instructions enabled, std::fma is inlined as one
+// instruction and vectorised, and otherwise it is a call into libm.
+template <typename Real>
+DIMENSIONS_DISPATCH_INLINE void FusedScaleInPlace(Real* data, std::size_t size,
+                                                  Real hi, Real lo) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    data[i] = std::fma(data[i], hi, data[i] * lo);
+  }
+}
+
+template <typename Real>
+DIMENSIONS_DISPATCH_INLINE void FusedScaleInto(const Real* __restrict in,
+                                               Real* __restrict out,
+                                               std::size_t size, Real hi,
+                                               Real lo) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = std::fma(in[i], hi, in[i] * lo);
+  }
+}
+
+template <typename Real>
+struct KernelSet {
+  void (*inPlace)(Real*, std::size_t, Real) noexcept;
+  void (*into)(const Real*, Real*, std::size_t, Real) noexcept;
+  void (*fusedInPlace)(Real*, std::size_t, Real, Real) noexcept;
+  void (*fusedInto)(const Real*, Real*, std::size_t, Real, Real) noexcept;
+};
+
+struct KernelTable {
+  Target target;
+  KernelSet<float> floats;
+  KernelSet<double> doubles;
+
+  template <typename Real>
+  constexpr const KernelSet<Real>& Get() const noexcept {
+    if constexpr (std::is_same_v<Real, float>) {
+      return floats;
+    } else {
+      return doubles;
+    }
+  }
+};
+
+// Defines the kernels of one target, with the given attributes, in the
+// current namespace.
+#define DIMENSIONS_DISPATCH_KERNELS(Attributes)                               \
+  Attributes void InPlaceFloat(float* data, std::size_t size,                 \
+                               float factor) noexcept {                       \
+    ScaleInPlace(data, size, factor);                                         \
+  }                                                                           \
+  Attributes void InPlaceDouble(double* data, std::size_t size,               \
+                                double factor) noexcept {                     \
+    ScaleInPlace(data, size, factor);                                         \
+  }                                                                           \
+  Attributes void IntoFloat(const float* in, float* out, std::size_t size,    \
+                            float factor) noexcept {                          \
+    ScaleInto(in, out, size, factor);                                         \
+  }                                                                           \
+  Attributes void IntoDouble(const double* in, double* out, std::size_t size, \
+                             double factor) noexcept {                        \
+    ScaleInto(in, out, size, factor);                                         \
+  }                                                                           \
+  Attributes void FusedInPlaceFloat(float* data, std::size_t size, float hi,  \
+                                    float lo) noexcept {                      \
+    FusedScaleInPlace(data, size, hi, lo);                                    \
+  }                                                                           \
+  Attributes void FusedInPlaceDouble(double* data, std::size_t size,          \
+                                     double hi, double lo) noexcept {         \
+    FusedScaleInPlace(data, size, hi, lo);                                    \
+  }                                                                           \
+  Attributes void FusedIntoFloat(const float* in, float* out,                 \
+                                 std::size_t size, float hi,                  \
+                                 float lo) noexcept {                         \
+    FusedScaleInto(in, out, size, hi, lo);                                    \
+  }                                                                           \
+  Attributes void FusedIntoDouble(const double* in, double* out,              \
+                                  std::size_t size, double hi,                \
+                                  double lo) noexcept {                       \
+    FusedScaleInto(in, out, size, hi, lo);                                    \
+  }
+
+#define DIMENSIONS_DISPATCH_TABLE(Name)                      \
+  constexpr KernelTable Name##Table = {                      \
+      .target = Target::Name,                                \
+      .floats = {.inPlace = Name::InPlaceFloat,              \
+                 .into = Name::IntoFloat,                    \
+                 .fusedInPlace = Name::FusedInPlaceFloat,    \
+                 .fusedInto = Name::FusedIntoFloat},         \
+      .doubles = {.inPlace = Name::InPlaceDouble,            \
+                  .into = Name::IntoDouble,                  \
+                  .fusedInPlace = Name::FusedInPlaceDouble,  \
+                  .fusedInto = Name::FusedIntoDouble}};
+
+namespace Baseline {
+DIMENSIONS_DISPATCH_KERNELS()
+}  // namespace Baseline
+DIMENSIONS_DISPATCH_TABLE(Baseline)
+
+#if DIMENSIONS_DISPATCH_X86
+namespace Avx2 {
+DIMENSIONS_DISPATCH_KERNELS(__attribute__((target("avx2,fma"))))
+}  // namespace Avx2
+DIMENSIONS_DISPATCH_TABLE(Avx2)
+
+namespace Avx512 {
+#if defined(__clang__)
+DIMENSIONS_DISPATCH_KERNELS(__attribute__((target("avx512f"))))
+#else
+// GCC otherwise limits the vectoriser to 256 bits for generic tuning.
+DIMENSIONS_DISPATCH_KERNELS(
+    __attribute__((target("avx512f,prefer-vector-width=512"))))
+#endif
+}  // namespace Avx512
+DIMENSIONS_DISPATCH_TABLE(Avx512)
+#endif
+
+#if DIMENSIONS_DISPATCH_SVE
+namespace Sve {
+DIMENSIONS_DISPATCH_KERNELS(__attribute__((target("+sve"))))
+}  // namespace Sve
+DIMENSIONS_DISPATCH_TABLE(Sve)
+#endif
+
+#undef DIMENSIONS_DISPATCH_TABLE
+#undef DIMENSIONS_DISPATCH_KERNELS
+
+// Returns the kernels for a target, or null if they were not built.
+constexpr const KernelTable* Find(Target target) noexcept {
+  switch (target) {
+    case Target::Baseline:
+      return &BaselineTable;
+#if DIMENSIONS_DISPATCH_X86
+    case Target::Avx2:
+      return &Avx2Table;
+    case Target::Avx512:
+      return &Avx512Table;
+#endif
+#if DIMENSIONS_DISPATCH_SVE
+    case Target::Sve:
+      return &SveTable;
+#endif
+    default:
+      return nullptr;
+  }
+}
+
+bool HostSupports(Target target) noexcept {
+  switch (target) {
+    case Target::Baseline:
+      return true;
+#if DIMENSIONS_DISPATCH_X86
+    case Target::Avx2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case Target::Avx512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f");
+#endif
+#if DIMENSIONS_DISPATCH_SVE
+    case Target::Sve:
+      return (getauxval(AT_HWCAP) & HWCAP_SVE) != 0;
+#endif
+    default:
+      return false;
+  }
+}
+
+// The targets in order of preference.
+constexpr Target Preference[] = {Target::Avx512, Target::Sve, Target::Avx2,
+                                 Target::Baseline};
+
+const KernelTable* Best() noexcept {
+  for (auto target : Preference) {
+    if (Supported(target)) return Find(target);
+  }
+  return &BaselineTable;
+}
+
+// The kernels in use, chosen on first use. Concurrent first calls may each
+// query the processor, but they store the same table.
+std::atomic<const KernelTable*> Active{nullptr};
+
+const KernelTable& ActiveKernels() noexcept {
+  auto* table = Active.load(std::memory_order_acquire);
+  if (table == nullptr) [[unlikely]] {
+    table = Best();
+    Active.store(table, std::memory_order_release);
+  }
+  return *table;
+}
+
+template <typename Real>
+void MultiplyImpl(std::span<Real> values, Real factor) noexcept {
+  ActiveKernels().Get<Real>().inPlace(values.data(), values.size(), factor);
+}
+
+template <typename Real>
+void MultiplyImpl(std::span<const Real> in, std::span<Real> out,
+                  Real factor) noexcept {
+  assert(in.size() == out.size());
+  const auto& kernels = ActiveKernels().Get<Real>();
+  if (in.data() == out.data()) {
+    kernels.inPlace(out.data(), out.size(), factor);
+  } else {
+    kernels.into(in.data(), out.data(), out.size(), factor);
+  }
+}
+
+template <typename Real>
+void MultiplyImpl(std::span<Real> values, DoubleWord<Real> factor) noexcept {
+  ActiveKernels().Get<Real>().fusedInPlace(values.data(), values.size(),
+                                           factor.High(), factor.Low());
+}
+
+template <typename Real>
+void MultiplyImpl(std::span<const Real> in, std::span<Real> out,
+                  DoubleWord<Real> factor) noexcept {
+  assert(in.size() == out.size());
+  const auto& kernels = ActiveKernels().Get<Real>();
+  if (in.data() == out.data()) {
+    kernels.fusedInPlace(out.data(), out.size(), factor.High(), factor.Low());
+  } else {
+    kernels.fusedInto(in.data(), out.data(), out.size(), factor.High(),
+                      factor.Low());
+  }
+}
+
+}  // namespace
+
+bool Supported(Target target) noexcept {
+  return Find(target) != nullptr && HostSupports(target);
+}
+
+Target ActiveTarget() noexcept { return ActiveKernels().target; }
+
+bool Select(Target target) noexcept {
+  if (!Supported(target)) return false;
+  Active.store(Find(target), std::memory_order_release);
+  return true;
+}
+
+void Multiply(std::span<float> values, float factor) noexcept {
+  MultiplyImpl(values, factor);
+}
+
+void Multiply(std::span<double> values, double factor) noexcept {
+  MultiplyImpl(values, factor);
+}
+
+void Multiply(std::span<const float> in, std::span<float> out,
+              float factor) noexcept {
+  MultiplyImpl(in, out, factor);
+}
+
+void Multiply(std::span<const double> in, std::span<double> out,
+              double factor) noexcept {
+  MultiplyImpl(in, out, factor);
+}
+
+void Multiply(std::span<float> values, DoubleWord<float> factor) noexcept {
+  MultiplyImpl(values, factor);
+}
+
+void Multiply(std::span<double> values, DoubleWord<double> factor) noexcept {
+  MultiplyImpl(values, factor);
+}
+
+void Multiply(std::span<const float> in, std::span<float> out,
+              DoubleWord<float> factor) noexcept {
+  MultiplyImpl(in, out, factor);
+}
+
+void Multiply(std::span<const double> in, std::span<double> out,
+              DoubleWord<double> factor) noexcept {
+  MultiplyImpl(in, out, factor);
+}
+
+}  // namespace Dimensions::Dispatch
@@ -0,0 +1,22 @@
+/**
+ * @file Instantiations.cpp
+ * @brief Explicit instantiations for the `Dimensions::Instantiations` library.
+ *
+ * @details Consumers that link against the library see the matching
+ * `extern template` declarations, which are enabled by the
+ * `DIMENSIONS_EXTERN_TEMPLATES` definition that the library propagates, and
+ * so do not instantiate these templates themselves.
+ */
+
+#include "Dimensions/Kernels.hpp"
+#include "Dimensions/RuntimeDimensions.hpp"
+#include "Dimensions/ScaleTable.hpp"
+
+DIMENSIONS_INSTANTIATE_KERNELS(template, float)
+DIMENSIONS_INSTANTIATE_KERNELS(template, double)
+
+DIMENSIONS_INSTANTIATE_CACHED_DIMENSIONS(template, float)
+DIMENSIONS_INSTANTIATE_CACHED_DIMENSIONS(template, double)
+
+DIMENSIONS_INSTANTIATE_RUNTIME_DIMENSIONS(template, float)
+DIMENSIONS_INSTANTIATE_RUNTIME_DIMENSIONS(template, double)
@@ -0,0 +1,349 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <execution>
+#include <vector>
+
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Parallel.hpp"
+
+class BatchUnitSystem
+    : public Dimensions::MechanicalMassDimensions<BatchUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+class BatchTest : public ::testing::Test {
+ protected:
+  BatchUnitSystem unit_system;
+
+  // Fills a vector with distinct values so that misplaced elements are
+  // detected.
+  static std::vector<double> MakeField(std::size_t size) {
+    auto field = std::vector<double>(size);
+    for (std::size_t i = 0; i < size; ++i) field[i] = 1.0 + 0.5 * i;
+    return field;
+  }
+};
+
+// The runtime selection must agree with the named accessors.
+TEST_F(BatchTest, RuntimeScaleMatchesAccessors) {
+  using Dimensions::QuantityKind;
+  EXPECT_EQ(unit_system.Scale(QuantityKind::Length), 2.0);
+  EXPECT_EQ(unit_system.Scale(QuantityKind::Mass), 3.0);
+  EXPECT_EQ(unit_system.Scale(QuantityKind::Traction),
+            unit_system.TractionScale());
+  EXPECT_EQ(unit_system.Scale(QuantityKind::Energy),
+            unit_system.EnergyScale());
+}
+
+// In-place conversion over sizes and offsets that exercise the peeled head,
+// the vector body and the scalar tail.
+TEST_F(BatchTest, InPlaceRoundTrip) {
+  using Dimensions::QuantityKind;
+  const auto scale = unit_system.TractionScale();
+  for (std::size_t size : {0, 1, 3, 7, 16, 33, 1000}) {
+    for (std::size_t offset : {0, 1, 2}) {
+      auto field = MakeField(size + offset);
+      const auto span = std::span<double>(field).subspan(offset);
+      unit_system.Redimensionalise(span, QuantityKind::Traction);
+      for (std::size_t i = 0; i < size; ++i) {
+        EXPECT_DOUBLE_EQ(span[i], (1.0 + 0.5 * (i + offset)) * scale);
+      }
+      unit_system.Nondimensionalise(span, QuantityKind::Traction);
+      for (std::size_t i = 0; i < size; ++i) {
+        EXPECT_DOUBLE_EQ(span[i], 1.0 + 0.5 * (i + offset));
+      }
+    }
+  }
+}
+
+// Out-of-place conversion with independently misaligned input and output.
+TEST_F(BatchTest, OutOfPlace) {
+  using Dimensions::QuantityKind;
+  const auto scale = unit_system.VelocityScale();
+  const auto in = MakeField(101);
+  auto out = std::vector<double>(101);
+  const auto src = std::span<const double>(in).subspan(1);
+  const auto dst = std::span<double>(out).first(100);
+  unit_system.Nondimensionalise(src, dst, QuantityKind::Velocity);
+  for (std::size_t i = 0; i < dst.size(); ++i) {
+    EXPECT_DOUBLE_EQ(dst[i], src[i] / scale);
+  }
+  unit_system.Redimensionalise(src, dst, QuantityKind::Velocity);
+  for (std::size_t i = 0; i < dst.size(); ++i) {
+    EXPECT_DOUBLE_EQ(dst[i], src[i] * scale);
+  }
+}
+
+// Parallel conversion must agree with the serial kernels, including for
+// fields spanning several chunks.
+TEST_F(BatchTest, ParallelMatchesSerial) {
+  using Dimensions::QuantityKind;
+  const auto field = MakeField(1 << 20);
+  auto serial = field;
+  auto parallel = field;
+  unit_system.Redimensionalise(std::span<double>(serial),
+                               QuantityKind::Traction);
+  Dimensions::Redimensionalise(std::execution::par_unseq, unit_system,
+                               std::span<double>(parallel),
+                               QuantityKind::Traction);
+  EXPECT_EQ(serial, parallel);
+
+  auto out = std::vector<double>(field.size());
+  Dimensions::Nondimensionalise(std::execution::par, unit_system,
+                                std::span<const double>(parallel),
+                                std::span<double>(out),
+                                QuantityKind::Traction);
+  unit_system.Nondimensionalise(std::span<double>(serial),
+                                QuantityKind::Traction);
+  EXPECT_EQ(serial, out);
+}
+
+// Interleaved records with a different quantity in each component are scaled
+// in a single pass, including record counts that leave a partial pattern.
+TEST_F(BatchTest, InterleavedComponents) {
+  using Dimensions::QuantityKind;
+  const auto components = std::array{
+      QuantityKind::Length, QuantityKind::Velocity, QuantityKind::Traction};
+  const auto scales =
+      std::array{unit_system.LengthScale(), unit_system.VelocityScale(),
+                 unit_system.TractionScale()};
+  for (std::size_t records : {0, 1, 21, 22, 100}) {
+    const auto field = MakeField(3 * records);
+    auto scaled = field;
+    unit_system.Redimensionalise(std::span<double>(scaled), components);
+    for (std::size_t i = 0; i < field.size(); ++i) {
+      EXPECT_DOUBLE_EQ(scaled[i], field[i] * scales[i % 3]);
+    }
+    auto restored = std::vector<double>(field.size());
+    unit_system.Nondimensionalise(std::span<const double>(scaled),
+                                  std::span<double>(restored), components);
+    for (std::size_t i = 0; i < field.size(); ++i) {
+      EXPECT_DOUBLE_EQ(restored[i], field[i]);
+    }
+  }
+}
+
+// A field whose size is not a multiple of the record length is scaled only
+// in its complete records, and nothing beyond the field is touched.
+TEST_F(BatchTest, InterleavedPartialRecord) {
+  using Dimensions::QuantityKind;
+  const auto components = std::array{
+      QuantityKind::Length, QuantityKind::Velocity, QuantityKind::Traction};
+  const auto scales =
+      std::array{unit_system.LengthScale(), unit_system.VelocityScale(),
+                 unit_system.TractionScale()};
+  for (std::size_t size : {1, 2, 4, 65, 101}) {
+    // A guard element follows the field in each buffer.
+    auto buffer = MakeField(size + 1);
+    const auto field = buffer;
+    const auto complete = size / 3 * 3;
+    unit_system.Redimensionalise(std::span<double>(buffer).first(size),
+                                 components);
+    auto out = std::vector<double>(size + 1, -1.0);
+    unit_system.Nondimensionalise(std::span<const double>(buffer).first(size),
+                                  std::span<double>(out).first(size),
+                                  components);
+    for (std::size_t i = 0; i < complete; ++i) {
+      EXPECT_DOUBLE_EQ(buffer[i], field[i] * scales[i % 3]);
+      EXPECT_DOUBLE_EQ(out[i], field[i]);
+    }
+    for (std::size_t i = complete; i <= size; ++i) {
+      EXPECT_EQ(buffer[i], field[i]);
+      EXPECT_EQ(out[i], -1.0);
+    }
+  }
+}
+
+#if DIMENSIONS_HAS_MDSPAN
+// Rank-one and rank-two mdspans are scaled whatever their layout.
+TEST_F(BatchTest, MdspanLayouts) {
+  using Dimensions::QuantityKind;
+  using Extents = std::dextents<std::size_t, 2>;
+  const auto components =
+      std::array{QuantityKind::Length, QuantityKind::Velocity};
+  const auto scales =
+      std::array{unit_system.LengthScale(), unit_system.VelocityScale()};
+  constexpr std::size_t rows = 37;
+  const auto field = MakeField(2 * rows);
+
+  auto values = field;
+  unit_system.Redimensionalise(std::mdspan(values.data(), 2 * rows),
+                               QuantityKind::Length);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(values[i], field[i] * scales[0]);
+  }
+
+  // Every second element, as a strided rank-one view.
+  values = field;
+  using Vector = std::dextents<std::size_t, 1>;
+  const auto strided = std::layout_stride::mapping<Vector>(
+      Vector(rows), std::array<std::size_t, 1>{2});
+  unit_system.Redimensionalise(std::mdspan(values.data(), strided),
+                               QuantityKind::Length);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(values[i], field[i] * (i % 2 == 0 ? scales[0] : 1.0));
+  }
+
+  // Row-major records.
+  values = field;
+  unit_system.Redimensionalise(
+      std::mdspan<double, Extents>(values.data(), rows, 2), components);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(values[i], field[i] * scales[i % 2]);
+  }
+
+  // Column-major records.
+  values = field;
+  unit_system.Redimensionalise(
+      std::mdspan<double, Extents, std::layout_left>(values.data(), rows, 2),
+      components);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(values[i], field[i] * scales[i / rows]);
+  }
+
+  // Strided records, padded to three elements per row.
+  auto padded = MakeField(3 * rows);
+  const auto original = padded;
+  const auto mapping = std::layout_stride::mapping<Extents>(
+      Extents(rows, 2), std::array<std::size_t, 2>{3, 1});
+  unit_system.Redimensionalise(std::mdspan(padded.data(), mapping),
+                               components);
+  for (std::size_t i = 0; i < padded.size(); ++i) {
+    const auto scale = i % 3 == 2 ? 1.0 : scales[i % 3];
+    EXPECT_DOUBLE_EQ(padded[i], original[i] * scale);
+  }
+}
+#endif
+
+// Compile-time factors are applied, and a unit factor leaves data unchanged.
+TEST_F(BatchTest, CompileTimeFactor) {
+  const auto field = MakeField(37);
+  auto scaled = field;
+  Dimensions::Kernels::Multiply<2.0>(std::span<double>(scaled));
+  auto copied = std::vector<double>(field.size());
+  Dimensions::Kernels::Multiply<1.0>(std::span<const double>(field),
+                                     std::span<double>(copied));
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_EQ(scaled[i], 2.0 * field[i]);
+    EXPECT_EQ(copied[i], field[i]);
+  }
+}
+
+// Single-precision storage is widened, scaled in double and rounded once.
+TEST_F(BatchTest, MixedPrecision) {
+  using Dimensions::QuantityKind;
+  const auto scale = unit_system.TractionScale();
+  for (std::size_t size : {0, 1, 5, 33, 1000}) {
+    auto stored = std::vector<float>(size);
+    for (std::size_t i = 0; i < size; ++i) stored[i] = 1.0f + 0.25f * i;
+
+    auto widened = std::vector<double>(size);
+    unit_system.Redimensionalise(std::span<const float>(stored),
+                                 std::span<double>(widened),
+                                 QuantityKind::Traction);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(widened[i], static_cast<double>(stored[i]) * scale);
+    }
+
+    auto narrowed = std::vector<float>(size);
+    unit_system.Nondimensionalise(std::span<const double>(widened),
+                                  std::span<float>(narrowed),
+                                  QuantityKind::Traction);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(narrowed[i], static_cast<float>(
+                                 widened[i] * unit_system.InverseScale(
+                                                  QuantityKind::Traction)));
+      EXPECT_FLOAT_EQ(narrowed[i], stored[i]);
+    }
+
+    auto scaled = std::vector<float>(size);
+    unit_system.Redimensionalise(std::span<const float>(stored),
+                                 std::span<float>(scaled),
+                                 QuantityKind::Traction);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(scaled[i],
+                static_cast<float>(static_cast<double>(stored[i]) * scale));
+    }
+  }
+}
+
+#if DIMENSIONS_HAS_FLOAT16
+// Half-precision storage is supported through the scalar path.
+TEST_F(BatchTest, HalfPrecisionStorage) {
+  using Dimensions::QuantityKind;
+  auto stored = std::vector<_Float16>();
+  for (float value : {1.0f, 0.5f, -2.0f, 3.25f}) {
+    stored.push_back(static_cast<_Float16>(value));
+  }
+  auto widened = std::vector<double>(stored.size());
+  unit_system.Redimensionalise(std::span<const _Float16>(stored),
+                               std::span<double>(widened),
+                               QuantityKind::Velocity);
+  for (std::size_t i = 0; i < stored.size(); ++i) {
+    EXPECT_DOUBLE_EQ(widened[i], static_cast<double>(stored[i]) *
+                                     unit_system.VelocityScale());
+  }
+  auto restored = std::vector<_Float16>(stored.size());
+  unit_system.Nondimensionalise(std::span<const double>(widened),
+                                std::span<_Float16>(restored),
+                                QuantityKind::Velocity);
+  for (std::size_t i = 0; i < stored.size(); ++i) {
+    EXPECT_EQ(static_cast<float>(restored[i]), static_cast<float>(stored[i]));
+  }
+}
+#endif
+
+// Complex and tensor elements are scaled as packed real components.
+TEST_F(BatchTest, PackedElementTypes) {
+  using Dimensions::QuantityKind;
+  using Dimensions::Kernels::PackedReal;
+  using Tensor = std::array<double, 6>;
+  static_assert(PackedReal<std::complex<double>>);
+  static_assert(PackedReal<Tensor>);
+  static_assert(PackedReal<std::array<std::complex<float>, 3>>);
+  static_assert(!PackedReal<double>);
+  static_assert(!PackedReal<int>);
+
+  // An odd size leaves a remainder after the vectorised loop.
+  constexpr std::size_t size = 37;
+  auto modes = std::vector<std::complex<double>>();
+  for (std::size_t i = 0; i < size; ++i) {
+    modes.emplace_back(1.0 + 0.5 * i, -0.25 * i);
+  }
+  const auto original = modes;
+  const auto scale = unit_system.TractionScale();
+  unit_system.Redimensionalise(std::span(modes), QuantityKind::Traction);
+  for (std::size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(modes[i].real(), original[i].real() * scale);
+    EXPECT_EQ(modes[i].imag(), original[i].imag() * scale);
+  }
+  auto restored = std::vector<std::complex<double>>(size);
+  unit_system.Nondimensionalise(modes, std::span(restored),
+                                QuantityKind::Traction);
+  for (std::size_t i = 0; i < size; ++i) {
+    EXPECT_DOUBLE_EQ(restored[i].real(), original[i].real());
+    EXPECT_DOUBLE_EQ(restored[i].imag(), original[i].imag());
+  }
+
+  auto stresses = std::vector<Tensor>(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < 6; ++j) stresses[i][j] = 1.0 * i + j;
+  }
+  auto scaled = std::vector<Tensor>(size);
+  unit_system.Redimensionalise(stresses, std::span(scaled),
+                               QuantityKind::Traction);
+  unit_system.Nondimensionalise(std::span(stresses), QuantityKind::Traction);
+  const auto inverse = unit_system.InverseScale(QuantityKind::Traction);
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < 6; ++j) {
+      EXPECT_EQ(scaled[i][j], (1.0 * i + j) * scale);
+      EXPECT_EQ(stresses[i][j], (1.0 * i + j) * inverse);
+    }
+  }
+}
@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "Dimensions/Compensated.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/DoubleWord.hpp"
+
+namespace {
+
+using Dimensions::DoubleWord;
+using Dimensions::QuantityKind;
+
+constexpr QuantityKind Kinds[] = {
+    QuantityKind::Length,       QuantityKind::Density,
+    QuantityKind::Time,         QuantityKind::Temperature,
+    QuantityKind::Mass,         QuantityKind::Velocity,
+    QuantityKind::Acceleration, QuantityKind::Force,
+    QuantityKind::Traction,     QuantityKind::Moment,
+    QuantityKind::Potential,    QuantityKind::Energy,
+    QuantityKind::HeatFlux,     QuantityKind::ThermalConductivity,
+    QuantityKind::SpecificHeat, QuantityKind::Entropy};
+
+// Integer base scales, so that every derived scale is a ratio of integers
+// small enough to be exact in double, and its correctly rounded value is
+// given by a single division.
+constexpr std::uint64_t L = 3, Rho = 7, T = 11, Theta = 5;
+
+class DensitySystem : public Dimensions::Dimensions<DensitySystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return L; }
+  constexpr double DensityScale() const noexcept { return Rho; }
+  constexpr double TimeScale() const noexcept { return T; }
+  constexpr double TemperatureScale() const noexcept { return Theta; }
+};
+
+// The same system, formulated through the mass scale.
+class MassSystem
+    : public Dimensions::ThermalMassDimensions<MassSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return L; }
+  constexpr double MassScale() const noexcept { return Rho * L * L * L; }
+  constexpr double TimeScale() const noexcept { return T; }
+  constexpr double TemperatureScale() const noexcept { return Theta; }
+};
+
+std::uint64_t Power(std::uint64_t base, int exponent) {
+  auto result = std::uint64_t{1};
+  for (int i = 0; i < exponent; ++i) result *= base;
+  return result;
+}
+
+// Returns the correctly rounded scale of the dimension L^l ρ^m T^t Θ^theta.
+double ExactScale(int l, int m, int t, int theta) {
+  auto numerator = std::uint64_t{1};
+  auto denominator = std::uint64_t{1};
+  const auto accumulate = [&](std::uint64_t base, int exponent) {
+    if (exponent > 0) numerator *= Power(base, exponent);
+    if (exponent < 0) denominator *= Power(base, -exponent);
+  };
+  accumulate(L, l);
+  accumulate(Rho, m);
+  accumulate(T, t);
+  accumulate(Theta, theta);
+  return static_cast<double>(numerator) / static_cast<double>(denominator);
+}
+
+template <typename Dim>
+double ExactScale(Dim) {
+  return ExactScale(Dim::Length + 3 * Dim::Mass, Dim::Mass, Dim::Time,
+                    Dim::Temperature);
+}
+
+}  // namespace
+
+TEST(DoubleWordTest, ProductsAreErrorFree) {
+  constexpr auto third = DoubleWord<double>(1.0) / DoubleWord<double>(3.0);
+  static_assert(third.High() == 1.0 / 3.0);
+  const auto runtime = DoubleWord<double>(1.0) / DoubleWord<double>(3.0);
+  EXPECT_EQ(runtime.High(), third.High());
+  EXPECT_EQ(runtime.Low(), third.Low());
+  // 1/3 is held to about 106 bits, so three times it is one to that
+  // precision.
+  const auto one = third * DoubleWord<double>(3.0);
+  EXPECT_EQ(one.High(), 1.0);
+  EXPECT_LT(std::abs(one.Low()), 0x1p-100);
+}
+
+TEST(DoubleWordTest, ComparesAndConverts) {
+  const auto x = DoubleWord<double>::FromParts(1.0, 0x1p-60);
+  EXPECT_GT(x, 1.0);
+  EXPECT_LT(-x, 0);
+  EXPECT_EQ(static_cast<double>(x), 1.0);
+  EXPECT_EQ(x - x, 0.0);
+  const auto narrowed = DoubleWord<float>(1.0 + 0x1p-30);
+  EXPECT_EQ(narrowed.High(), 1.0f);
+  EXPECT_EQ(narrowed.Low(), 0x1p-30f);
+}
+
+// The leading part of every compensated scale is correctly rounded, and is
+// the same whether the system is formulated through density or mass.
+TEST(CompensatedScaleTest, ScalesAreCorrectlyRounded) {
+  const auto density = DensitySystem();
+  const auto mass = MassSystem();
+  for (const auto kind : Kinds) {
+    Dimensions::VisitDimension(kind, [&]<typename Dim>(Dim) {
+      const auto exact = ExactScale(Dim{});
+      const auto inverse = ExactScale(Dimensions::DimensionInverse<Dim>{});
+      EXPECT_EQ(density.CompensatedScale<Dim>().High(), exact);
+      EXPECT_EQ(mass.CompensatedScale<Dim>().High(), exact);
+      EXPECT_EQ(density.CompensatedInverseScale<Dim>().High(), inverse);
+      EXPECT_EQ(mass.CompensatedInverseScale<Dim>().High(), inverse);
+      EXPECT_EQ(Dimensions::Compensated::Scale(density, kind).High(), exact);
+      EXPECT_EQ(Dimensions::Compensated::InverseScale(mass, kind).High(),
+                inverse);
+    });
+  }
+}
+
+TEST(CompensatedScaleTest, IsConstantExpression) {
+  constexpr auto energy =
+      DensitySystem().CompensatedScale<Dimensions::Energy>();
+  static_assert(energy.High() == 1701.0 / 121.0);
+  EXPECT_EQ(energy.Low(),
+            DensitySystem().CompensatedScale<Dimensions::Energy>().Low());
+}
+
+class CompensatedBatchTest : public ::testing::Test {
+ protected:
+  // An odd size, with an offset start, exercises the vector remainders.
+  void SetUp() override {
+    buffer.resize(1002);
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+      buffer[i] = 0.1 * static_cast<double>(i) - 7.3;
+    }
+    in = std::span<const double>(buffer).subspan(1);
+  }
+
+  std::vector<double> buffer;
+  std::span<const double> in;
+  DensitySystem system;
+};
+
+// Every element is the single fused product of the value and both parts of
+// the factor, whichever path is taken.
+TEST_F(CompensatedBatchTest, MatchesScalarFusedProducts) {
+  const auto kind = QuantityKind::Energy;
+  const auto factor = Dimensions::Compensated::Scale(system, kind);
+  const auto inverse = Dimensions::Compensated::InverseScale(system, kind);
+  auto values = std::vector<double>(in.begin(), in.end());
+  auto out = std::vector<double>(in.size());
+  Dimensions::Compensated::Redimensionalise(system, values, kind);
+  Dimensions::Compensated::Redimensionalise(system, in, out, kind);
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto x = in[i];
+    const auto expected = std::fma(x, factor.High(), x * factor.Low());
+    EXPECT_EQ(values[i], expected);
+    EXPECT_EQ(out[i], expected);
+  }
+  Dimensions::Compensated::Nondimensionalise(system, values, kind);
+  Dimensions::Compensated::Nondimensionalise(system, in, out, kind);
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    const auto x = in[i];
+    const auto expected = std::fma(x, inverse.High(), x * inverse.Low());
+    EXPECT_EQ(out[i], expected);
+    // A round trip is within one ulp of the original value.
+    EXPECT_LE(std::abs(values[i] - x),
+              std::abs(x) * std::numeric_limits<double>::epsilon());
+  }
+}
+
+TEST_F(CompensatedBatchTest, PowerOfTwoScalesRoundTripExactly) {
+  // With these base scales every derived scale is a power of two.
+  class BinarySystem : public Dimensions::Dimensions<BinarySystem, double> {
+   public:
+    constexpr double LengthScale() const noexcept { return 8.0; }
+    constexpr double DensityScale() const noexcept { return 0.25; }
+    constexpr double TimeScale() const noexcept { return 2.0; }
+    constexpr double TemperatureScale() const noexcept { return 1.0; }
+  };
+  const auto binary = BinarySystem();
+  auto values = std::vector<double>(in.begin(), in.end());
+  for (const auto kind : Kinds) {
+    Dimensions::Compensated::Nondimensionalise(binary, values, kind);
+    Dimensions::Compensated::Redimensionalise(binary, values, kind);
+    for (std::size_t i = 0; i < in.size(); ++i) EXPECT_EQ(values[i], in[i]);
+  }
+}
+
+TEST(CompensatedFloatTest, ScalesFloatData) {
+  class FloatSystem : public Dimensions::Dimensions<FloatSystem, float> {
+   public:
+    constexpr float LengthScale() const noexcept { return 6.371e6f; }
+    constexpr float DensityScale() const noexcept { return 5.5e3f; }
+    constexpr float TimeScale() const noexcept { return 3.6e3f; }
+    constexpr float TemperatureScale() const noexcept { return 1.0f; }
+  };
+  const auto system = FloatSystem();
+  const auto kind = QuantityKind::Force;
+  const auto factor = Dimensions::Compensated::Scale(system, kind);
+  EXPECT_EQ(factor.High(), system.Scale(kind));
+  auto values = std::vector<float>(37);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = 1.5f * static_cast<float>(i);
+  }
+  Dimensions::Compensated::Redimensionalise(system, values, kind);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const auto x = 1.5f * static_cast<float>(i);
+    EXPECT_EQ(values[i], std::fma(x, factor.High(), x * factor.Low()));
+  }
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <span>
+#include <type_traits>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/RuntimeDimensions.hpp"
+#include "Dimensions/SystemBatch.hpp"
+
+#if !defined(DIMENSIONS_COMPENSATED_SCALES)
+#error "These tests must be built with DIMENSIONS_COMPENSATED_SCALES."
+#endif
+
+namespace {
+
+constexpr double L = 3.0, Rho = 7.0, T = 11.0, Theta = 5.0;
+
+class DensitySystem : public Dimensions::Dimensions<DensitySystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return L; }
+  constexpr double DensityScale() const noexcept { return Rho; }
+  constexpr double TimeScale() const noexcept { return T; }
+  constexpr double TemperatureScale() const noexcept { return Theta; }
+};
+
+class MassSystem
+    : public Dimensions::MechanicalMassDimensions<MassSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return L; }
+  constexpr double MassScale() const noexcept { return Rho * L * L * L; }
+  constexpr double TimeScale() const noexcept { return T; }
+};
+
+}  // namespace
+
+TEST(CompensatedScalesTest, AccumulatesInDoubleWords) {
+  static_assert(std::is_same_v<DensitySystem::ExtendedReal,
+                               Dimensions::DoubleWord<double>>);
+  using FloatSystem = Dimensions::RuntimeDimensions<float>;
+  static_assert(std::is_same_v<FloatSystem::ExtendedReal, double>);
+}
+
+// Each scale is rounded once from its double-word value, so the ordinary
+// accessors return the correctly rounded ratios of the integer base scales,
+// for either formulation of the system.
+TEST(CompensatedScalesTest, ScalesAreCorrectlyRounded) {
+  constexpr auto density = DensitySystem();
+  constexpr auto mass = MassSystem();
+  static_assert(density.EnergyScale() == 1701.0 / 121.0);
+  EXPECT_EQ(mass.EnergyScale(), 1701.0 / 121.0);
+  EXPECT_EQ(density.InverseScale<Dimensions::Energy>(), 121.0 / 1701.0);
+  EXPECT_EQ(mass.InverseScale<Dimensions::Force>(), 121.0 / 567.0);
+  EXPECT_EQ(density.HeatFluxScale(), 7.0 * 27.0 / 1331.0);
+  EXPECT_EQ(density.EntropyScale(), 1701.0 / 605.0);
+  EXPECT_EQ(density.TryScale<Dimensions::Potential>(), 9.0 / 121.0);
+}
+
+TEST(CompensatedScalesTest, DerivedUtilitiesAgree) {
+  const auto runtime = Dimensions::RuntimeDimensions<double>(
+      {.lengthScale = L,
+       .densityScale = Rho,
+       .timeScale = T,
+       .temperatureScale = Theta});
+  const auto density = DensitySystem();
+  EXPECT_EQ(runtime.EnergyScale(), density.EnergyScale());
+  EXPECT_EQ(runtime.GravitationalConstant(), density.GravitationalConstant());
+  EXPECT_EQ(runtime.BoltzmannConstant(), density.BoltzmannConstant());
+  EXPECT_EQ(Dimensions::ConversionFactor<Dimensions::Energy>(density,
+                                                              MassSystem()),
+            1.0);
+
+  const auto batch = Dimensions::SystemBatch<double>({L}, {Rho}, {T}, {Theta});
+  double energy = 0;
+  batch.Scales<Dimensions::Energy>(std::span(&energy, 1));
+  EXPECT_EQ(energy, 1701.0 / 121.0);
+  double kB = 0;
+  batch.BoltzmannConstants(std::span(&kB, 1));
+  EXPECT_EQ(kB, density.BoltzmannConstant());
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "Dimensions/Conversion.hpp"
+
+namespace {
+
+// The CGS system from the documentation.
+class CgsSystem
+    : public Dimensions::MechanicalMassDimensions<CgsSystem, double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 0.01; }
+  constexpr auto MassScale() const noexcept { return 0.001; }
+  constexpr auto TimeScale() const noexcept { return 1.0; }
+};
+
+// An Earth-scaled system as in the examples.
+class EarthSystem : public Dimensions::Dimensions<EarthSystem, double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 6.371e6; }
+  constexpr auto DensityScale() const noexcept { return 5.514e3; }
+  constexpr auto TimeScale() const noexcept { return 3600.0; }
+  constexpr auto TemperatureScale() const noexcept { return 273.15; }
+};
+
+// Float systems whose energy and entropy scales overflow float, although
+// the ratios between them do not.
+template <int Factor>
+class WideSystem : public Dimensions::Dimensions<WideSystem<Factor>, float> {
+ public:
+  constexpr float LengthScale() const noexcept { return Factor * 1e20f; }
+  constexpr float DensityScale() const noexcept { return 1e3f; }
+  constexpr float TimeScale() const noexcept { return 1e-3f; }
+  constexpr float TemperatureScale() const noexcept { return 1e3f; }
+};
+
+constexpr Dimensions::QuantityKind Kinds[] = {
+    Dimensions::QuantityKind::Length,
+    Dimensions::QuantityKind::Density,
+    Dimensions::QuantityKind::Time,
+    Dimensions::QuantityKind::Temperature,
+    Dimensions::QuantityKind::Mass,
+    Dimensions::QuantityKind::Velocity,
+    Dimensions::QuantityKind::Acceleration,
+    Dimensions::QuantityKind::Force,
+    Dimensions::QuantityKind::Traction,
+    Dimensions::QuantityKind::Moment,
+    Dimensions::QuantityKind::Potential,
+    Dimensions::QuantityKind::Energy,
+    Dimensions::QuantityKind::HeatFlux,
+    Dimensions::QuantityKind::ThermalConductivity,
+    Dimensions::QuantityKind::SpecificHeat,
+    Dimensions::QuantityKind::Entropy};
+
+// Checks that the runtime factor of every quantity is bit-identical to the
+// compile-time factor.
+template <typename From, typename To>
+void CheckRuntimeFactors(const From& from, const To& to) {
+  for (const auto kind : Kinds) {
+    Dimensions::VisitDimension(kind, [&]<typename Dim>(Dim) {
+      const auto expected = Dimensions::ConversionFactor<Dim>(from, to);
+      EXPECT_EQ(Dimensions::ConversionFactor(from, to, kind), expected);
+      EXPECT_TRUE(std::isfinite(expected));
+    });
+  }
+}
+
+}  // namespace
+
+TEST(ConversionTest, RuntimeFactorMatchesCompileTimeFactor) {
+  CheckRuntimeFactors(CgsSystem{}, EarthSystem{});
+  CheckRuntimeFactors(EarthSystem{}, CgsSystem{});
+
+  const auto from = WideSystem<1>{};
+  const auto to = WideSystem<2>{};
+  ASSERT_TRUE(std::isinf(from.EnergyScale()));
+  CheckRuntimeFactors(from, to);
+  EXPECT_EQ(Dimensions::ConversionFactor(from, to,
+                                         Dimensions::QuantityKind::Energy),
+            0.03125f);
+}
+
+// The fused factor must agree with the two-step route through SI units, and
+// be available at compile time.
+TEST(ConversionTest, FactorMatchesTwoStepConversion) {
+  constexpr auto cgs = CgsSystem{};
+  constexpr auto earth = EarthSystem{};
+  constexpr auto factor =
+      Dimensions::ConversionFactor<Dimensions::Traction>(cgs, earth);
+  EXPECT_DOUBLE_EQ(factor, cgs.TractionScale() / earth.TractionScale());
+  EXPECT_DOUBLE_EQ(Dimensions::ConversionFactor(
+                       cgs, earth, Dimensions::QuantityKind::Traction),
+                   factor);
+}
+
+// Batch conversion applies the fused factor in a single pass.
+TEST(ConversionTest, BatchConversion) {
+  using Dimensions::QuantityKind;
+  const auto cgs = CgsSystem{};
+  const auto earth = EarthSystem{};
+  const auto factor =
+      Dimensions::ConversionFactor(cgs, earth, QuantityKind::Velocity);
+
+  auto field = std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0};
+  auto out = std::vector<double>(field.size());
+  Dimensions::Convert(cgs, earth, std::span<const double>(field),
+                      std::span<double>(out), QuantityKind::Velocity);
+  Dimensions::Convert(cgs, earth, std::span<double>(field),
+                      QuantityKind::Velocity);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], (i + 1) * factor);
+    EXPECT_EQ(field[i], out[i]);
+  }
+}
+
+// Single-precision data is converted with a double-precision factor.
+TEST(ConversionTest, MixedPrecisionConversion) {
+  using Dimensions::QuantityKind;
+  const auto cgs = CgsSystem{};
+  const auto earth = EarthSystem{};
+  const auto factor =
+      Dimensions::ConversionFactor(cgs, earth, QuantityKind::Energy);
+
+  const auto field = std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+  auto out = std::vector<double>(field.size());
+  Dimensions::Convert(cgs, earth, std::span<const float>(field),
+                      std::span<double>(out), QuantityKind::Energy);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_EQ(out[i], static_cast<double>(field[i]) * factor);
+  }
+}
+
+// Complex fields are converted as packed real and imaginary parts.
+TEST(ConversionTest, ComplexConversion) {
+  using Dimensions::QuantityKind;
+  const auto cgs = CgsSystem{};
+  const auto earth = EarthSystem{};
+  const auto factor =
+      Dimensions::ConversionFactor(cgs, earth, QuantityKind::Traction);
+
+  auto field = std::vector<std::complex<float>>{{1.0f, -1.0f}, {2.0f, 0.5f}};
+  auto out = std::vector<std::complex<float>>(field.size());
+  Dimensions::Convert(cgs, earth, field, std::span(out),
+                      QuantityKind::Traction);
+  Dimensions::Convert(cgs, earth, std::span(field), QuantityKind::Traction);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_EQ(out[i], field[i]);
+  }
+  EXPECT_FLOAT_EQ(out[1].imag(), static_cast<float>(0.5 * factor));
+}
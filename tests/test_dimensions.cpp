@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <type_traits>
+
 #include "Dimensions/Dimensions.hpp"
 
 // Use a concrete implementation of the Dimensions CRTP base class for testing.
@@ -61,3 +64,167 @@ TEST_F(DimensionsTest, DimensionlessConstantsAreCorrect) {
   EXPECT_DOUBLE_EQ(unit_system.GravitationalConstant(),
                    expected_dimensionless_G);
 }
+
+// A purely compile-time unit system must carry no per-object data.
+TEST_F(DimensionsTest, UnitSystemIsEmpty) {
+  EXPECT_TRUE(std::is_empty_v<MyUnitSystem>);
+  EXPECT_TRUE(std::is_trivially_copyable_v<MyUnitSystem>);
+}
+
+// Test the generic scale accessor against hand-computed values.
+TEST_F(DimensionsTest, GenericScaleIsCorrect) {
+  // Dynamic viscosity = M / (L * T) = 3.0 / (2.0 * 4.0) = 0.375
+  EXPECT_DOUBLE_EQ((unit_system.Scale<-1, 1, -1, 0>()), 0.375);
+
+  // Kinematic viscosity = L^2 / T = 4.0 / 4.0 = 1.0
+  EXPECT_DOUBLE_EQ((unit_system.Scale<2, 0, -1, 0>()), 1.0);
+
+  // The named accessors are aliases of the generic one.
+  EXPECT_EQ(unit_system.Scale<Dimensions::Force>(), unit_system.ForceScale());
+  EXPECT_EQ(unit_system.Scale<Dimensions::Dimensionless>(), 1.0);
+
+  // The factors are available at compile time.
+  constexpr auto traction = MyUnitSystem{}.Scale<Dimensions::Traction>();
+  static_assert(traction == 3.0 / (2.0 * 16.0));
+}
+
+// Test the reciprocal scale accessors.
+TEST_F(DimensionsTest, InverseScalesAreCorrect) {
+  // 1 / Velocity = T / L = 4.0 / 2.0 = 2.0
+  EXPECT_EQ(unit_system.InverseScale<Dimensions::Velocity>(), 2.0);
+  EXPECT_EQ(unit_system.InverseScale(Dimensions::QuantityKind::Velocity), 2.0);
+
+  // 1 / Density = L^3 / M = 8.0 / 3.0
+  EXPECT_DOUBLE_EQ((unit_system.InverseScale<-3, 1, 0, 0>()), 8.0 / 3.0);
+}
+
+namespace {
+
+// A kernel specialised on the base scales of a unit system.
+template <auto Constants>
+constexpr double VelocityFactor() {
+  return Dimensions::ConstantDimensions<Constants>{}.VelocityScale();
+}
+
+}  // namespace
+
+// Base scales can be passed as a non-type template argument.
+TEST_F(DimensionsTest, SystemConstantsAsTemplateArgument) {
+  constexpr auto constants = MyUnitSystem{}.Constants();
+  static_assert(constants.lengthScale == 2.0);
+  static_assert(constants.densityScale == 0.375);
+  static_assert(VelocityFactor<constants>() == 0.5);
+
+  using System = Dimensions::ConstantDimensions<constants>;
+  EXPECT_TRUE(std::is_empty_v<System>);
+  EXPECT_DOUBLE_EQ(System{}.EnergyScale(), unit_system.EnergyScale());
+  EXPECT_EQ(System{}.Constants(), constants);
+}
+
+namespace {
+
+// A single-precision system whose base scales make intermediate products
+// overflow float, although the derived scales themselves do not.
+class WideRangeSystem : public Dimensions::Dimensions<WideRangeSystem, float> {
+ public:
+  constexpr float LengthScale() const noexcept { return 1.0e10f; }
+  constexpr float DensityScale() const noexcept { return 1.0f; }
+  constexpr float TimeScale() const noexcept { return 1.0e12f; }
+  constexpr float TemperatureScale() const noexcept { return 1.0f; }
+};
+
+// A single-precision astronomical system.
+class SolarSystem
+    : public Dimensions::MechanicalMassDimensions<SolarSystem, float> {
+ public:
+  constexpr float LengthScale() const noexcept { return 1.0e13f; }
+  constexpr float MassScale() const noexcept { return 2.0e30f; }
+  constexpr float TimeScale() const noexcept { return 3.0e7f; }
+};
+
+}  // namespace
+
+// Derived scales of float systems are accumulated in double and rounded once.
+TEST(ExtendedPrecisionTest, FloatScalesDoNotOverflowInternally) {
+  static_assert(std::is_same_v<WideRangeSystem::ExtendedReal, double>);
+  constexpr auto system = WideRangeSystem{};
+  static_assert(system.MomentScale() == 1.0e26f);
+  EXPECT_FLOAT_EQ(system.EnergyScale(), 1.0e26f);
+  EXPECT_FLOAT_EQ(system.InverseScale<Dimensions::Energy>(), 1.0e-26f);
+
+  constexpr auto solar = SolarSystem{};
+  EXPECT_FLOAT_EQ(solar.GravitationalConstant(),
+                  static_cast<float>(6.67430e-11 * 2.0e30 * 9.0e14 / 1.0e39));
+}
+
+// Scales that cannot be represented in Real are reported.
+TEST(ExtendedPrecisionTest, TryScaleReportsUnrepresentableFactors) {
+  constexpr auto solar = SolarSystem{};
+  static_assert(!solar.TryScale<Dimensions::Energy>().has_value());
+  using InverseEnergy = Dimensions::DimensionInverse<Dimensions::Energy>;
+  static_assert(!solar.TryScale<InverseEnergy>().has_value());
+  EXPECT_TRUE(std::isinf(solar.EnergyScale()));
+
+  constexpr auto velocity = solar.TryScale<Dimensions::Velocity>();
+  ASSERT_TRUE(velocity.has_value());
+  EXPECT_FLOAT_EQ(*velocity, solar.VelocityScale());
+  EXPECT_TRUE(solar.TryScale<Dimensions::Dimensionless>().has_value());
+}
+
+namespace {
+
+// A system with a temperature scale built on the mass-based thermal helper.
+class ThermalUnitSystem
+    : public Dimensions::ThermalMassDimensions<ThermalUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+  constexpr double TemperatureScale() const noexcept { return 5.0; }
+};
+
+}  // namespace
+
+// Test the thermal scales against hand-computed values.
+TEST(ThermalDimensionsTest, ThermalScalesAreCorrect) {
+  constexpr auto system = ThermalUnitSystem{};
+  static_assert(system.TemperatureScale() == 5.0);
+  static_assert(system.DensityScale() == 3.0 / 8.0);
+
+  // Heat flux = M / T^3 = 3.0 / 64.0
+  static_assert(system.HeatFluxScale() == 3.0 / 64.0);
+
+  // Thermal conductivity = L M / (T^3 Θ) = 6.0 / 320.0
+  EXPECT_DOUBLE_EQ(system.ThermalConductivityScale(), 6.0 / 320.0);
+
+  // Specific heat = L^2 / (T^2 Θ) = 4.0 / 80.0
+  EXPECT_DOUBLE_EQ(system.SpecificHeatScale(), 0.05);
+
+  // Entropy = energy / Θ = 0.75 / 5.0
+  EXPECT_DOUBLE_EQ(system.EntropyScale(), 0.15);
+  EXPECT_DOUBLE_EQ(system.EntropyScale(), system.EnergyScale() / 5.0);
+
+  using Dimensions::QuantityKind;
+  EXPECT_EQ(system.Scale(QuantityKind::Entropy), system.EntropyScale());
+  EXPECT_EQ(system.InverseScale(QuantityKind::HeatFlux),
+            system.InverseScale<Dimensions::HeatFlux>());
+  EXPECT_TRUE((std::is_same_v<
+               Dimensions::DimensionOf<QuantityKind::ThermalConductivity>,
+               Dimensions::ThermalConductivity>));
+
+  // Thermal conductivity is heat flux times length per temperature.
+  using Conductivity = Dimensions::DimensionQuotient<
+      Dimensions::DimensionProduct<Dimensions::HeatFlux, Dimensions::Length>,
+      Dimensions::Temperature>;
+  EXPECT_TRUE(
+      (std::is_same_v<Conductivity, Dimensions::ThermalConductivity>));
+}
+
+// kB' = kB * Θ / energy uses the temperature scale of the thermal helper.
+TEST(ThermalDimensionsTest, BoltzmannConstantUsesTemperatureScale) {
+  constexpr auto system = ThermalUnitSystem{};
+  EXPECT_DOUBLE_EQ(system.BoltzmannConstant(),
+                   1.380649e-23 * 5.0 / system.EnergyScale());
+  EXPECT_DOUBLE_EQ(system.BoltzmannConstant(),
+                   1.380649e-23 / system.EntropyScale());
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Dispatch.hpp"
+
+namespace {
+
+using Dimensions::Dispatch::Target;
+
+constexpr Target Targets[] = {Target::Baseline, Target::Avx2, Target::Avx512,
+                              Target::Sve};
+
+class DispatchSystem : public Dimensions::Dimensions<DispatchSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 10.0; }
+  constexpr double DensityScale() const noexcept { return 2.0; }
+  constexpr double TimeScale() const noexcept { return 5.0; }
+  constexpr double TemperatureScale() const noexcept { return 1.0; }
+};
+
+// Checks every kernel of the active target against a scalar loop. An odd
+// size, and an offset start, exercise the vector remainders.
+template <typename Real>
+void CheckKernels() {
+  constexpr std::size_t size = 1001;
+  auto buffer = std::vector<Real>(size + 1);
+  for (std::size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = static_cast<Real>(0.5) * static_cast<Real>(i);
+  }
+  const auto in = std::span<const Real>(buffer).subspan(1);
+  const auto factor = static_cast<Real>(3.25);
+
+  auto out = std::vector<Real>(size);
+  Dimensions::Dispatch::Multiply(in, out, factor);
+  auto values = std::vector<Real>(in.begin(), in.end());
+  Dimensions::Dispatch::Multiply(std::span(values), factor);
+  for (std::size_t i = 0; i < size; ++i) {
+    EXPECT_EQ(out[i], in[i] * factor);
+    EXPECT_EQ(values[i], in[i] * factor);
+  }
+
+  // The fused kernels must give the bits of std::fma on every target.
+  const auto hi = static_cast<Real>(1) / static_cast<Real>(3);
+  const auto lo = std::fma(-hi, static_cast<Real>(3), static_cast<Real>(1)) /
+                  static_cast<Real>(3);
+  const auto fused = Dimensions::DoubleWord<Real>::FromParts(hi, lo);
+  Dimensions::Dispatch::Multiply(in, out, fused);
+  values.assign(in.begin(), in.end());
+  Dimensions::Dispatch::Multiply(std::span(values), fused);
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto expected = std::fma(in[i], hi, in[i] * lo);
+    EXPECT_EQ(out[i], expected);
+    EXPECT_EQ(values[i], expected);
+  }
+}
+
+}  // namespace
+
+// The first use selects the most capable supported target.
+TEST(DispatchTest, SelectsBestSupportedTarget) {
+  using Dimensions::Dispatch::Supported;
+  EXPECT_TRUE(Supported(Target::Baseline));
+  const auto active = Dimensions::Dispatch::ActiveTarget();
+  EXPECT_TRUE(Supported(active));
+  if (Supported(Target::Avx512)) {
+    EXPECT_EQ(active, Target::Avx512);
+  } else if (Supported(Target::Sve)) {
+    EXPECT_EQ(active, Target::Sve);
+  } else if (Supported(Target::Avx2)) {
+    EXPECT_EQ(active, Target::Avx2);
+  } else {
+    EXPECT_EQ(active, Target::Baseline);
+  }
+}
+
+// Every supported target gives the same results as a scalar loop.
+TEST(DispatchTest, EveryTargetMatchesScalarLoop) {
+  const auto original = Dimensions::Dispatch::ActiveTarget();
+  for (auto target : Targets) {
+    SCOPED_TRACE(Dimensions::Dispatch::TargetName(target));
+    if (!Dimensions::Dispatch::Select(target)) {
+      EXPECT_FALSE(Dimensions::Dispatch::Supported(target));
+      continue;
+    }
+    EXPECT_EQ(Dimensions::Dispatch::ActiveTarget(), target);
+    CheckKernels<float>();
+    CheckKernels<double>();
+  }
+  EXPECT_TRUE(Dimensions::Dispatch::Select(original));
+}
+
+// The batch conversions of unit systems use the dispatched kernels.
+TEST(DispatchTest, BatchConversionsAreDispatched) {
+  const auto system = DispatchSystem();
+  auto field = std::vector<double>(100, 2.0);
+  auto out = std::vector<double>(field.size());
+  system.Redimensionalise(std::span<const double>(field),
+                          std::span<double>(out),
+                          Dimensions::QuantityKind::Velocity);
+  system.Nondimensionalise(std::span<double>(out),
+                           Dimensions::QuantityKind::Velocity);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], 2.0);
+  }
+}
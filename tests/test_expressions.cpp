@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Dimensions/Expressions.hpp"
+
+class ExpressionSystem
+    : public Dimensions::Dimensions<ExpressionSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 10.0; }
+  constexpr double DensityScale() const noexcept { return 2.0; }
+  constexpr double TimeScale() const noexcept { return 5.0; }
+  constexpr double TemperatureScale() const noexcept { return 1.0; }
+};
+
+namespace {
+
+using Nondimensional =
+    Dimensions::Expressions::FieldExpression<Dimensions::Velocity, double>;
+using Dimensional =
+    Dimensions::Expressions::QuantityFieldExpression<Dimensions::Velocity,
+                                                     double>;
+
+template <typename L, typename R>
+concept Addable = requires(const L& l, const R& r) { l + r; };
+
+template <typename L, typename R>
+concept Multipliable = requires(const L& l, const R& r) { l * r; };
+
+template <typename E>
+concept Redimensionalisable =
+    requires(const ExpressionSystem& system, const E& e,
+             std::span<double> out) {
+      Dimensions::Expressions::Redimensionalise(system, e, out);
+    };
+
+template <typename E>
+concept Nondimensionalisable =
+    requires(const ExpressionSystem& system, const E& e,
+             std::span<double> out) {
+      Dimensions::Expressions::Nondimensionalise(system, e, out);
+    };
+
+}  // namespace
+
+class ExpressionsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // An odd size exercises both the vector and the scalar loops.
+    for (std::size_t i = 0; i < 37; ++i) {
+      rho.push_back(1.0 + 0.1 * static_cast<double>(i));
+      v.push_back(0.5 - 0.03 * static_cast<double>(i));
+    }
+  }
+
+  ExpressionSystem system;
+  std::vector<double> rho;
+  std::vector<double> v;
+};
+
+TEST_F(ExpressionsTest, DimensionIsDeducedAtCompileTime) {
+  using namespace Dimensions::Expressions;
+  using Dimensions::Density;
+  using Dimensions::Velocity;
+  const auto energy = Field<Density>(rho) * Field<Velocity>(v) *
+                      Field<Velocity>(v) / 2;
+  static_assert(std::is_same_v<decltype(energy)::DimensionType,
+                               Dimensions::Traction>);
+  const auto ratio = Field<Velocity>(v) / Field<Velocity>(v);
+  static_assert(
+      std::is_same_v<decltype(ratio)::DimensionType, Dimensions::Dimensionless>);
+  EXPECT_EQ(energy.size(), rho.size());
+}
+
+TEST_F(ExpressionsTest, RedimensionalisesInOnePass) {
+  using namespace Dimensions::Expressions;
+  using Dimensions::Density;
+  using Dimensions::Velocity;
+  auto out = std::vector<double>(rho.size());
+  Redimensionalise(system,
+                   Field<Density>(rho) * Field<Velocity>(v) *
+                       Field<Velocity>(v) / 2,
+                   out);
+  const auto scale = system.Scale<Dimensions::Traction>();
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], rho[i] * v[i] * v[i] / 2 * scale);
+  }
+}
+
+TEST_F(ExpressionsTest, EvaluatesSumsNegationAndConstants) {
+  using namespace Dimensions::Expressions;
+  using Dimensions::Velocity;
+  auto out = std::vector<double>(v.size());
+  Evaluate(-(Field<Velocity>(v) + 3.0 * Field<Velocity>(v)) -
+               Field<Velocity>(v) / 4,
+           out);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], -(v[i] + 3.0 * v[i]) - v[i] / 4);
+  }
+  Evaluate(1.0 / Field<Velocity>(v), out);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], 1.0 / v[i]);
+  }
+}
+
+TEST_F(ExpressionsTest, NondimensionalisesQuantityFields) {
+  using namespace Dimensions::Expressions;
+  using Dimensions::Quantity;
+  using Dimensions::Velocity;
+  auto speeds = std::vector<Quantity<Velocity>>();
+  for (auto x : v) speeds.emplace_back(x);
+  auto out = std::vector<double>(speeds.size());
+  Nondimensionalise(system, Field(speeds) * Field(speeds), out);
+  const auto inverse = system.InverseScale<
+      Dimensions::DimensionProduct<Velocity, Velocity>>();
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], v[i] * v[i] * inverse);
+  }
+}
+
+// Nondimensional and SI-valued fields of the same dimension cannot be
+// combined, and each form can only be converted into the other.
+TEST(ExpressionFormTest, RejectsMixedForms) {
+  using Dimensions::Expressions::ConstantExpression;
+  using Dimensions::Expressions::ValueForm;
+  static_assert(Addable<Nondimensional, Nondimensional>);
+  static_assert(Addable<Dimensional, Dimensional>);
+  static_assert(!Addable<Nondimensional, Dimensional>);
+  static_assert(!Addable<Dimensional, Nondimensional>);
+  static_assert(!Multipliable<Nondimensional, Dimensional>);
+  static_assert(Multipliable<Dimensional, ConstantExpression<double>>);
+  static_assert(Nondimensional::Form == ValueForm::Nondimensional);
+  using Scaled = decltype(std::declval<Nondimensional>() * 2.0 +
+                          std::declval<Nondimensional>());
+  static_assert(Scaled::Form == ValueForm::Nondimensional);
+  using Negated = decltype(-std::declval<Dimensional>());
+  static_assert(Negated::Form == ValueForm::Dimensional);
+
+  static_assert(Redimensionalisable<Nondimensional>);
+  static_assert(!Redimensionalisable<Dimensional>);
+  static_assert(Nondimensionalisable<Dimensional>);
+  static_assert(!Nondimensionalisable<Nondimensional>);
+  static_assert(!Redimensionalisable<ConstantExpression<double>>);
+  static_assert(!Nondimensionalisable<ConstantExpression<double>>);
+}
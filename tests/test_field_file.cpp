@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Dimensions/FieldFile.hpp"
+
+namespace {
+
+class EarthSystem : public Dimensions::Dimensions<EarthSystem, double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 6.371e6; }
+  constexpr auto DensityScale() const noexcept { return 5.514e3; }
+  constexpr auto TimeScale() const noexcept { return 3600.0; }
+  constexpr auto TemperatureScale() const noexcept { return 273.15; }
+};
+
+class MarsSystem : public Dimensions::Dimensions<MarsSystem, double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 3.3895e6; }
+  constexpr auto DensityScale() const noexcept { return 3.933e3; }
+  constexpr auto TimeScale() const noexcept { return 1800.0; }
+  constexpr auto TemperatureScale() const noexcept { return 210.0; }
+};
+
+// A system formulated through its mass scale, which forms its scales
+// differently from the density-based systems.
+class VenusSystem : public Dimensions::ThermalMassDimensions<VenusSystem,
+                                                             double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 6.0518e6; }
+  constexpr auto MassScale() const noexcept { return 4.8675e24; }
+  constexpr auto TimeScale() const noexcept { return 2.0997e7; }
+  constexpr auto TemperatureScale() const noexcept { return 737.0; }
+};
+
+constexpr Dimensions::QuantityKind Kinds[] = {
+    Dimensions::QuantityKind::Length,
+    Dimensions::QuantityKind::Density,
+    Dimensions::QuantityKind::Time,
+    Dimensions::QuantityKind::Temperature,
+    Dimensions::QuantityKind::Mass,
+    Dimensions::QuantityKind::Velocity,
+    Dimensions::QuantityKind::Acceleration,
+    Dimensions::QuantityKind::Force,
+    Dimensions::QuantityKind::Traction,
+    Dimensions::QuantityKind::Moment,
+    Dimensions::QuantityKind::Potential,
+    Dimensions::QuantityKind::Energy,
+    Dimensions::QuantityKind::HeatFlux,
+    Dimensions::QuantityKind::ThermalConductivity,
+    Dimensions::QuantityKind::SpecificHeat,
+    Dimensions::QuantityKind::Entropy};
+
+// Serialises a field into an in-memory buffer.
+template <typename Real>
+std::vector<std::byte> Serialise(const std::vector<Real>& values,
+                                 Dimensions::QuantityKind kind) {
+  auto stream = std::ostringstream(std::ios::binary);
+  Dimensions::WriteField(stream, EarthSystem{},
+                         std::span<const Real>(values), kind);
+  const auto text = stream.str();
+  auto bytes = std::vector<std::byte>(text.size());
+  std::memcpy(bytes.data(), text.data(), text.size());
+  return bytes;
+}
+
+}  // namespace
+
+// A field read back in the system that wrote it is used in place.
+TEST(FieldFileTest, RoundTripInSameSystem) {
+  const auto values = std::vector<double>{1.0, -2.5, 3.25, 0.0, 7.0};
+  const auto bytes = Serialise(values, Dimensions::QuantityKind::Velocity);
+  ASSERT_EQ(bytes.size(), sizeof(Dimensions::FieldHeader) +
+                              values.size() * sizeof(double));
+
+  const auto field = Dimensions::FieldView<double>(bytes);
+  EXPECT_TRUE(field.Holds<Dimensions::Velocity>());
+  EXPECT_FALSE(field.Holds<Dimensions::Force>());
+  EXPECT_EQ(field.Constants(), EarthSystem{}.Constants());
+  EXPECT_TRUE(field.IsNondimensionalIn(EarthSystem{}));
+  EXPECT_EQ(field.Values().data(),
+            reinterpret_cast<const double*>(bytes.data() +
+                                            Dimensions::FieldAlignment * 2));
+  EXPECT_TRUE(std::equal(values.begin(), values.end(),
+                         field.Values().begin(), field.Values().end()));
+}
+
+// A field read in another system is converted by the fused factor.
+TEST(FieldFileTest, ConversionOnRead) {
+  using Dimensions::QuantityKind;
+  const auto values = std::vector<float>{1.0f, 2.0f, 3.0f};
+  const auto bytes = Serialise(values, QuantityKind::Traction);
+  const auto field = Dimensions::FieldView<float>(bytes);
+  const auto mars = MarsSystem{};
+  const auto factor =
+      Dimensions::ConversionFactor(EarthSystem{}, mars, QuantityKind::Traction);
+  EXPECT_FALSE(field.IsNondimensionalIn(mars));
+  EXPECT_EQ(field.ConversionFactor(mars), factor);
+
+  auto i = std::size_t{0};
+  for (auto value : field.Converted(mars)) {
+    EXPECT_FLOAT_EQ(value, values[i++] * static_cast<float>(factor));
+  }
+  EXPECT_EQ(i, values.size());
+}
+
+// The factor applied on reading is bit-identical to the direct conversion
+// factor between the writer and reader, for every quantity.
+TEST(FieldFileTest, ConversionFactorMatchesDirectConversion) {
+  const auto values = std::vector<double>{1.0};
+  for (const auto kind : Kinds) {
+    const auto bytes = Serialise(values, kind);
+    const auto field = Dimensions::FieldView<double>(bytes);
+    Dimensions::VisitDimension(kind, [&]<typename Dim>(Dim) {
+      EXPECT_EQ(field.ConversionFactor(MarsSystem{}),
+                Dimensions::ConversionFactor<Dim>(EarthSystem{}, MarsSystem{}));
+      EXPECT_EQ(
+          field.ConversionFactor(VenusSystem{}),
+          Dimensions::ConversionFactor<Dim>(EarthSystem{}, VenusSystem{}));
+    });
+    EXPECT_TRUE(field.IsNondimensionalIn(EarthSystem{}));
+  }
+}
+
+// Malformed or mismatched files are rejected.
+TEST(FieldFileTest, InvalidFilesThrow) {
+  auto bytes = Serialise(std::vector<double>(4, 1.0),
+                         Dimensions::QuantityKind::Length);
+  EXPECT_THROW(Dimensions::FieldView<float>{bytes}, std::runtime_error);
+
+  auto truncated = std::span<const std::byte>(bytes).first(bytes.size() - 1);
+  EXPECT_THROW(Dimensions::FieldView<double>{truncated}, std::runtime_error);
+
+  bytes[0] = std::byte{'X'};
+  EXPECT_THROW(Dimensions::FieldView<double>{bytes}, std::runtime_error);
+}
+
+#if DIMENSIONS_HAS_MMAP
+// A field written to disk can be mapped and viewed without copying.
+TEST(FieldFileTest, MappedFile) {
+  const auto path =
+      std::filesystem::temp_directory_path() / "dimensions_field_test.dim";
+  const auto values = std::vector<double>{4.0, 5.0, 6.0};
+  {
+    auto file = std::ofstream(path, std::ios::binary);
+    Dimensions::WriteField(file, EarthSystem{},
+                           std::span<const double>(values),
+                           Dimensions::QuantityKind::Energy);
+  }
+  {
+    const auto file = Dimensions::MappedFile(path.string());
+    const auto field = Dimensions::FieldView<double>(file.Bytes());
+    EXPECT_TRUE(field.Holds<Dimensions::Energy>());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(),
+                           field.Values().begin(), field.Values().end()));
+  }
+  std::filesystem::remove(path);
+  EXPECT_THROW(Dimensions::MappedFile(path.string()), std::runtime_error);
+}
+#endif
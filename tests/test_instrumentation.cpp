@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Dimensions/Conversion.hpp"
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Instrumentation.hpp"
+#include "Dimensions/InstrumentationJson.hpp"
+
+// This file is compiled into its own executable with
+// DIMENSIONS_ENABLE_INSTRUMENTATION defined.
+static_assert(Dimensions::Instrumentation::Enabled);
+
+class InstrumentedSystem
+    : public Dimensions::Dimensions<InstrumentedSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 10.0; }
+  constexpr double DensityScale() const noexcept { return 2.0; }
+  constexpr double TimeScale() const noexcept { return 5.0; }
+  constexpr double TemperatureScale() const noexcept { return 1.0; }
+};
+
+class InstrumentationTest : public ::testing::Test {
+ protected:
+  void SetUp() override { Dimensions::Instrumentation::Reset(); }
+
+  InstrumentedSystem system;
+};
+
+TEST_F(InstrumentationTest, CountsCallsElementsAndBytes) {
+  using Dimensions::QuantityKind;
+  auto values = std::vector<double>(100, 1.0);
+  auto out = std::vector<double>(values.size());
+  system.Nondimensionalise(values, QuantityKind::Length);
+  system.Redimensionalise(std::span<const double>(values), out,
+                          QuantityKind::Length);
+  system.Redimensionalise(values, QuantityKind::Velocity);
+
+  const auto snapshot = Dimensions::Instrumentation::Capture();
+  const auto& length = snapshot[QuantityKind::Length];
+  EXPECT_EQ(length.calls, 2u);
+  EXPECT_EQ(length.elements, 200u);
+  EXPECT_EQ(length.bytes, 4 * 100 * sizeof(double));
+  EXPECT_EQ(snapshot[QuantityKind::Velocity].calls, 1u);
+  EXPECT_EQ(snapshot[QuantityKind::Time].calls, 0u);
+  EXPECT_EQ(snapshot.Total().calls, 3u);
+  EXPECT_EQ(snapshot.Total().elements, 300u);
+}
+
+TEST_F(InstrumentationTest, CountsInterleavedAndConvertedData) {
+  using Dimensions::QuantityKind;
+  constexpr auto components =
+      std::array{QuantityKind::Length, QuantityKind::Velocity};
+  auto records = std::vector<double>(20, 1.0);
+  system.Redimensionalise(std::span<double>(records),
+                          std::span<const QuantityKind>(components));
+  Dimensions::Convert(system, system, std::span<double>(records),
+                      QuantityKind::Force);
+
+  const auto snapshot = Dimensions::Instrumentation::Capture();
+  EXPECT_EQ(snapshot.Interleaved().calls, 1u);
+  EXPECT_EQ(snapshot.Interleaved().elements, 20u);
+  EXPECT_EQ(snapshot[QuantityKind::Force].calls, 1u);
+}
+
+TEST_F(InstrumentationTest, AggregatesAcrossThreads) {
+  using Dimensions::QuantityKind;
+  constexpr int threads = 4;
+  constexpr int calls = 50;
+  auto workers = std::vector<std::thread>();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([this] {
+      auto values = std::vector<double>(10, 1.0);
+      for (int i = 0; i < calls; ++i) {
+        system.Nondimensionalise(values, QuantityKind::Energy);
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+
+  // Threads that have exited still contribute to the totals.
+  const auto energy =
+      Dimensions::Instrumentation::Capture()[QuantityKind::Energy];
+  EXPECT_EQ(energy.calls, static_cast<std::uint64_t>(threads * calls));
+  EXPECT_EQ(energy.elements, static_cast<std::uint64_t>(threads * calls * 10));
+}
+
+TEST_F(InstrumentationTest, ResetAndExport) {
+  using Dimensions::QuantityKind;
+  auto values = std::vector<double>(8, 1.0);
+  system.Nondimensionalise(values, QuantityKind::Density);
+  const auto snapshot = Dimensions::Instrumentation::Capture();
+
+  auto names = std::vector<std::string>();
+  Dimensions::Instrumentation::Visit(
+      snapshot, [&](std::string_view name, const auto& counters) {
+        names.emplace_back(name);
+        EXPECT_EQ(counters.elements, 8u);
+      });
+  EXPECT_EQ(names, std::vector<std::string>{"Density"});
+
+  const auto json = Dimensions::Instrumentation::ToJson(snapshot);
+  EXPECT_EQ(json.rfind("{\"Density\":{\"calls\":1,\"elements\":8,\"bytes\":128,"
+                       "\"nanoseconds\":",
+                       0),
+            0u);
+  EXPECT_EQ(json.back(), '}');
+
+  Dimensions::Instrumentation::Reset();
+  EXPECT_EQ(Dimensions::Instrumentation::Capture().Total(),
+            Dimensions::Instrumentation::Counters{});
+  EXPECT_EQ(Dimensions::Instrumentation::ToJson(
+                Dimensions::Instrumentation::Capture()),
+            "{}");
+}
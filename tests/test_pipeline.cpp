@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "Dimensions/Pipeline.hpp"
+
+class PipelineSystem : public Dimensions::Dimensions<PipelineSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 10.0; }
+  constexpr double DensityScale() const noexcept { return 2.0; }
+  constexpr double TimeScale() const noexcept { return 5.0; }
+  constexpr double TemperatureScale() const noexcept { return 1.0; }
+};
+
+class PipelineTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (std::size_t i = 0; i < 1000; ++i) {
+      field.push_back(static_cast<double>(i));
+    }
+  }
+
+  // Returns a reader that copies the field out in buffer-sized pieces.
+  auto Reader() {
+    return [this, offset = std::size_t{0}](std::span<double> buffer) mutable {
+      const auto count = std::min(buffer.size(), field.size() - offset);
+      std::copy_n(field.begin() + static_cast<std::ptrdiff_t>(offset), count,
+                  buffer.begin());
+      offset += count;
+      return count;
+    };
+  }
+
+  PipelineSystem system;
+  std::vector<double> field;
+};
+
+TEST_F(PipelineTest, ScalesChunksInOrder) {
+  auto out = std::vector<double>();
+  auto chunks = std::size_t{0};
+  auto pipeline = Dimensions::MakeRedimensionalisePipeline(
+      system, Dimensions::QuantityKind::Velocity, 64, 3,
+      [&](std::span<const double> chunk) {
+        EXPECT_LE(chunk.size(), 64u);
+        out.insert(out.end(), chunk.begin(), chunk.end());
+        ++chunks;
+      });
+  pipeline.Pump(Reader());
+  ASSERT_EQ(out.size(), field.size());
+  EXPECT_EQ(chunks, (field.size() + 63) / 64);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    EXPECT_DOUBLE_EQ(out[i], field[i] * system.VelocityScale());
+  }
+}
+
+TEST_F(PipelineTest, ConvertsBetweenSystems) {
+  auto out = std::vector<double>();
+  auto pipeline = Dimensions::MakeConvertPipeline<double>(
+      system, system, Dimensions::QuantityKind::Force, 100, 2,
+      [&](std::span<const double> chunk) {
+        out.insert(out.end(), chunk.begin(), chunk.end());
+      });
+  pipeline.Pump(Reader());
+  EXPECT_EQ(out, field);
+}
+
+TEST_F(PipelineTest, ManualSubmissionAndFinish) {
+  auto total = 0.0;
+  auto pipeline = Dimensions::MakeNondimensionalisePipeline(
+      system, Dimensions::QuantityKind::Length, 4, 1,
+      [&](std::span<const double> chunk) {
+        for (auto x : chunk) total += x;
+      });
+  for (int i = 0; i < 5; ++i) {
+    auto buffer = pipeline.Acquire();
+    std::fill(buffer.begin(), buffer.end(), 10.0);
+    pipeline.Submit(buffer.first(2));
+  }
+  pipeline.Finish();
+  EXPECT_DOUBLE_EQ(total, 10.0);
+}
+
+TEST_F(PipelineTest, SinkErrorsAreRethrown) {
+  auto pipeline = Dimensions::MakeRedimensionalisePipeline(
+      system, Dimensions::QuantityKind::Time, 16, 2,
+      [](std::span<const double>) { throw std::runtime_error("full"); });
+  EXPECT_THROW(pipeline.Pump(Reader()), std::runtime_error);
+  EXPECT_THROW(pipeline.Finish(), std::runtime_error);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "Dimensions/Quantisation.hpp"
+
+namespace {
+
+class EarthSystem : public Dimensions::Dimensions<EarthSystem, double> {
+ public:
+  constexpr auto LengthScale() const noexcept { return 6.371e6; }
+  constexpr auto DensityScale() const noexcept { return 5.514e3; }
+  constexpr auto TimeScale() const noexcept { return 3600.0; }
+  constexpr auto TemperatureScale() const noexcept { return 273.15; }
+};
+
+}  // namespace
+
+// The ends and centre of the range map to the extreme and zero codes.
+TEST(QuantisationTest, RangeMapsOntoCodes) {
+  constexpr auto quantiser = Dimensions::Quantiser<std::int16_t>(-2.0, 6.0);
+  static_assert(quantiser.MaximumCode == 32767);
+  static_assert(quantiser.Offset() == 2.0);
+  EXPECT_EQ(quantiser.Encode(-2.0), -32767);
+  EXPECT_EQ(quantiser.Encode(2.0), 0);
+  EXPECT_EQ(quantiser.Encode(6.0), 32767);
+  EXPECT_DOUBLE_EQ(quantiser.Decode(32767), 6.0);
+  EXPECT_DOUBLE_EQ(quantiser.Minimum(), -2.0);
+
+  // Out-of-range values and NaN are clamped.
+  EXPECT_EQ(quantiser.Encode(100.0), 32767);
+  EXPECT_EQ(quantiser.Encode(-100.0), -32767);
+  EXPECT_EQ(quantiser.Encode(std::numeric_limits<double>::quiet_NaN()),
+            -32767);
+}
+
+// A reduced bit budget limits the code range.
+TEST(QuantisationTest, BitBudget) {
+  using Quantiser = Dimensions::Quantiser<std::int16_t, float, 10>;
+  static_assert(Quantiser::MaximumCode == 511);
+  const auto quantiser = Quantiser::Symmetric(1.0f);
+  EXPECT_EQ(quantiser.Encode(1.0f), 511);
+  EXPECT_EQ(quantiser.Encode(2.0f), 511);
+  EXPECT_FLOAT_EQ(quantiser.MaximumError(), 0.5f / 511);
+}
+
+// Batch encoding agrees with the scalar path, and decoding is accurate to
+// within the predicted bound, over sizes exercising the vector body and tail.
+TEST(QuantisationTest, BatchRoundTripWithinBound) {
+  const auto quantiser = Dimensions::Quantiser<std::int32_t>::Symmetric(4.0);
+  for (std::size_t size : {0, 1, 3, 17, 1000}) {
+    auto values = std::vector<double>(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      values[i] = 5.0 * std::sin(0.37 * i);
+    }
+    auto codes = std::vector<std::int32_t>(size);
+    quantiser.Encode(std::span<const double>(values),
+                     std::span<std::int32_t>(codes));
+    auto decoded = std::vector<double>(size);
+    quantiser.Decode(std::span<const std::int32_t>(codes),
+                     std::span<double>(decoded));
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(codes[i], quantiser.Encode(values[i]));
+      const auto expected = std::fmin(std::fmax(values[i], -4.0), 4.0);
+      EXPECT_LE(std::abs(decoded[i] - expected), quantiser.MaximumError());
+    }
+  }
+}
+
+// Codes with more digits than the value type saturate at the largest
+// representable code, on both the scalar and the batch paths.
+template <typename Code, typename Real>
+void CheckSaturation(Code high) {
+  const auto quantiser = Dimensions::Quantiser<Code, Real>(-1, 1);
+  ASSERT_LE(high, quantiser.MaximumCode);
+  const auto low = static_cast<Code>(-high);
+  const auto big = std::numeric_limits<Real>::max();
+  const auto inf = std::numeric_limits<Real>::infinity();
+  const auto nan = std::numeric_limits<Real>::quiet_NaN();
+  // Enough values to fill at least one vector, with a scalar tail.
+  auto values = std::vector<Real>();
+  auto expected = std::vector<Code>();
+  for (int repeat = 0; repeat < 3; ++repeat) {
+    values.insert(values.end(), {1, 2, big, inf, -1, -2, -big, -inf, nan, 0});
+    expected.insert(expected.end(),
+                    {high, high, high, high, low, low, low, low, low, 0});
+  }
+  auto codes = std::vector<Code>(values.size());
+  quantiser.Encode(std::span<const Real>(values), std::span<Code>(codes));
+  EXPECT_EQ(codes, expected);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(quantiser.Encode(values[i]), expected[i]);
+  }
+}
+
+TEST(QuantisationTest, SaturatesAtBothEnds) {
+  CheckSaturation<std::int16_t, double>(32767);
+  CheckSaturation<std::int32_t, double>(2147483647);
+  // 2^31 - 1 rounds up to 2^31 as a float.
+  CheckSaturation<std::int32_t, float>(2147483520);
+  // 2^63 - 1 rounds up to 2^63 as a double.
+  CheckSaturation<std::int64_t, double>(std::int64_t{9223372036854774784});
+}
+
+TEST(QuantisationTest, FullWidthSixtyFourBitCodes) {
+  using Quantiser = Dimensions::Quantiser<std::int64_t>;
+  static_assert(Quantiser::MaximumCode ==
+                std::numeric_limits<std::int64_t>::max());
+  static_assert(Dimensions::Quantiser<std::int64_t, double, 40>::MaximumCode ==
+                (std::int64_t{1} << 39) - 1);
+  const auto quantiser = Quantiser::Symmetric(4.0);
+  auto values = std::vector<double>(37);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = 3.0 * std::sin(0.37 * i);
+  }
+  auto codes = std::vector<std::int64_t>(values.size());
+  quantiser.Encode(std::span<const double>(values),
+                   std::span<std::int64_t>(codes));
+  auto decoded = std::vector<double>(values.size());
+  quantiser.Decode(std::span<const std::int64_t>(codes),
+                   std::span<double>(decoded));
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(codes[i], quantiser.Encode(values[i]));
+    EXPECT_NEAR(decoded[i], values[i], 1e-15);
+  }
+}
+
+// Nondimensionalisation is fused with encoding, and the dimensional error
+// bound follows from the scale of the quantity.
+TEST(QuantisationTest, FusedWithUnitSystem) {
+  using Dimensions::QuantityKind;
+  const auto system = EarthSystem{};
+  const auto scale = system.VelocityScale();
+  const auto quantiser = Dimensions::Quantiser<std::int16_t>::Symmetric(1.0);
+
+  auto velocities = std::vector<double>(50);
+  for (std::size_t i = 0; i < velocities.size(); ++i) {
+    velocities[i] = scale * (0.04 * i - 1.0);
+  }
+  auto codes = std::vector<std::int16_t>(velocities.size());
+  Dimensions::Quantise(system, quantiser,
+                       std::span<const double>(velocities),
+                       std::span<std::int16_t>(codes), QuantityKind::Velocity);
+  auto decoded = std::vector<double>(velocities.size());
+  Dimensions::Dequantise(system, quantiser,
+                         std::span<const std::int16_t>(codes),
+                         std::span<double>(decoded), QuantityKind::Velocity);
+
+  const auto bound = quantiser.MaximumError() * scale * (1 + 1e-12);
+  for (std::size_t i = 0; i < velocities.size(); ++i) {
+    EXPECT_EQ(codes[i],
+              quantiser.Encode(velocities[i] * system.InverseScale(
+                                                   QuantityKind::Velocity)));
+    EXPECT_LE(std::abs(decoded[i] - velocities[i]), bound);
+  }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "Dimensions/Dimensions.hpp"
+
+namespace {
+
+class QuantityUnitSystem
+    : public Dimensions::MechanicalMassDimensions<QuantityUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+using Dimensions::Quantity;
+using LengthQ = Quantity<Dimensions::Length>;
+using TimeQ = Quantity<Dimensions::Time>;
+using VelocityQ = Quantity<Dimensions::Velocity>;
+
+// Detects whether two quantity types can be added.
+template <typename A, typename B>
+concept Addable = requires(A a, B b) { a + b; };
+
+}  // namespace
+
+// The wrapper must add no storage or layout overhead.
+TEST(QuantityTest, ZeroOverheadLayout) {
+  EXPECT_EQ(sizeof(VelocityQ), sizeof(double));
+  EXPECT_EQ(alignof(VelocityQ), alignof(double));
+  EXPECT_TRUE(std::is_trivially_copyable_v<VelocityQ>);
+  EXPECT_TRUE(std::is_standard_layout_v<VelocityQ>);
+}
+
+// Products and quotients carry the correct dimension, and mismatched sums are
+// rejected at compile time.
+TEST(QuantityTest, DimensionalArithmetic) {
+  constexpr auto v = LengthQ(6.0) / TimeQ(2.0);
+  static_assert(std::is_same_v<decltype(v), const VelocityQ>);
+  EXPECT_EQ(v.Value(), 3.0);
+
+  constexpr auto sum = v + VelocityQ(1.0);
+  EXPECT_EQ(sum.Value(), 4.0);
+
+  constexpr double ratio = v / VelocityQ(1.5);
+  EXPECT_EQ(ratio, 2.0);
+
+  static_assert(Addable<VelocityQ, VelocityQ>);
+  static_assert(!Addable<VelocityQ, LengthQ>);
+}
+
+// Conversion to and from nondimensional form uses the owning system.
+TEST(QuantityTest, ConversionThroughSystem) {
+  constexpr auto system = QuantityUnitSystem{};
+  constexpr auto v = VelocityQ(1.0);
+  constexpr auto x = system.Nondimensionalise(v);
+  EXPECT_DOUBLE_EQ(x, 1.0 / system.VelocityScale());
+
+  constexpr auto back = system.Redimensionalise<Dimensions::Velocity>(x);
+  static_assert(std::is_same_v<decltype(back), const VelocityQ>);
+  EXPECT_DOUBLE_EQ(back.Value(), 1.0);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "Dimensions/Dimensions.hpp"
+#include "Dimensions/Records.hpp"
+
+namespace {
+
+class RecordUnitSystem
+    : public Dimensions::MechanicalMassDimensions<RecordUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+struct Particle {
+  std::array<double, 3> position;
+  double velocity[3];
+  double density;
+  int id;
+  double energy;
+};
+
+using ParticleLayout = Dimensions::RecordLayout<
+    Particle,
+    Dimensions::RecordField<&Particle::position, Dimensions::Length>,
+    Dimensions::RecordField<&Particle::velocity, Dimensions::Velocity>,
+    Dimensions::RecordField<&Particle::density, Dimensions::Density>,
+    Dimensions::RecordField<&Particle::energy, Dimensions::Energy>>;
+
+std::vector<Particle> MakeParticles() {
+  auto particles = std::vector<Particle>(5);
+  for (int i = 0; i < 5; ++i) {
+    particles[i] = {{1.0 * i, 2.0 * i, 3.0 * i},
+                    {4.0 * i, 5.0 * i, 6.0 * i},
+                    7.0 * i,
+                    i,
+                    8.0 * i};
+  }
+  return particles;
+}
+
+}  // namespace
+
+// Each listed member is scaled by the factor for its dimension, and unlisted
+// members are untouched.
+TEST(RecordsTest, ScalesEveryField) {
+  constexpr auto system = RecordUnitSystem{};
+  static_assert(ParticleLayout::FieldCount == 4);
+  static_assert(ParticleLayout::ComponentCount == 8);
+
+  const auto original = MakeParticles();
+  auto particles = original;
+  Dimensions::Redimensionalise<ParticleLayout>(system,
+                                               std::span<Particle>(particles));
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    for (std::size_t k = 0; k < 3; ++k) {
+      EXPECT_DOUBLE_EQ(particles[i].position[k],
+                       original[i].position[k] * system.LengthScale());
+      EXPECT_DOUBLE_EQ(particles[i].velocity[k],
+                       original[i].velocity[k] * system.VelocityScale());
+    }
+    EXPECT_DOUBLE_EQ(particles[i].density,
+                     original[i].density * system.DensityScale());
+    EXPECT_DOUBLE_EQ(particles[i].energy,
+                     original[i].energy * system.EnergyScale());
+    EXPECT_EQ(particles[i].id, original[i].id);
+  }
+
+  Dimensions::Nondimensionalise<ParticleLayout>(system,
+                                                std::span<Particle>(particles));
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    EXPECT_DOUBLE_EQ(particles[i].density, original[i].density);
+  }
+}
+
+// The transposing variant writes one scaled column per scalar component.
+TEST(RecordsTest, TransposeToColumns) {
+  constexpr auto system = RecordUnitSystem{};
+  const auto particles = MakeParticles();
+  auto storage = std::vector<std::vector<double>>(
+      ParticleLayout::ComponentCount,
+      std::vector<double>(particles.size()));
+  auto columns = ParticleLayout::Columns{};
+  for (std::size_t c = 0; c < columns.size(); ++c) columns[c] = storage[c];
+
+  ParticleLayout::Transpose(particles, ParticleLayout::Scales(system),
+                            columns);
+  for (std::size_t i = 0; i < particles.size(); ++i) {
+    EXPECT_DOUBLE_EQ(storage[1][i],
+                     particles[i].position[1] * system.LengthScale());
+    EXPECT_DOUBLE_EQ(storage[5][i],
+                     particles[i].velocity[2] * system.VelocityScale());
+    EXPECT_DOUBLE_EQ(storage[6][i],
+                     particles[i].density * system.DensityScale());
+    EXPECT_DOUBLE_EQ(storage[7][i], particles[i].energy * system.EnergyScale());
+  }
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <stdexcept>
+
+#include "Dimensions/RuntimeDimensions.hpp"
+
+namespace {
+
+class EarthSystem
+    : public Dimensions::MechanicalMassDimensions<EarthSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 6.371e6; }
+  constexpr double MassScale() const noexcept { return 5.972e24; }
+  constexpr double TimeScale() const noexcept { return 3600.0; }
+};
+
+constexpr auto EarthConfig = R"(
+# Earth-normalised units
+length = 6.371e6
+mass   = 5.972e24   # kg
+time   = 3600
+)";
+
+}  // namespace
+
+// A system parsed from configuration reproduces the compile-time system with
+// the same scales.
+TEST(RuntimeDimensionsTest, ConfigMatchesCompileTimeSystem) {
+  const auto system = Dimensions::RuntimeDimensions<>::FromConfig(EarthConfig);
+  const auto earth = EarthSystem{};
+  EXPECT_EQ(system.Constants(), earth.Constants());
+  EXPECT_DOUBLE_EQ(system.MassScale(), earth.MassScale());
+  EXPECT_DOUBLE_EQ(system.EnergyScale(), earth.EnergyScale());
+  EXPECT_DOUBLE_EQ(system.GravitationalConstant(),
+                   earth.GravitationalConstant());
+  EXPECT_DOUBLE_EQ(system.InverseScale(Dimensions::QuantityKind::Traction),
+                   earth.InverseScale(Dimensions::QuantityKind::Traction));
+
+  auto stream = std::istringstream("length = 2\ndensity = 3\ntime = 4\n"
+                                   "temperature = 5\n");
+  const auto parsed = Dimensions::RuntimeDimensions<float>::FromConfig(stream);
+  EXPECT_EQ(parsed.Constants(),
+            (Dimensions::SystemConstants<float>{2.0f, 3.0f, 4.0f, 5.0f}));
+}
+
+// Malformed configurations are rejected.
+TEST(RuntimeDimensionsTest, InvalidConfigThrows) {
+  using System = Dimensions::RuntimeDimensions<>;
+  EXPECT_THROW(System::FromConfig("length = 1\ntime = 1\n"),
+               std::runtime_error);
+  EXPECT_THROW(System::FromConfig("length = 1\nmass = 1\ndensity = 1\n"
+                                  "time = 1\n"),
+               std::runtime_error);
+  EXPECT_THROW(System::FromConfig("length = 1\nmass = 1\ntime = -1\n"),
+               std::runtime_error);
+  EXPECT_THROW(System::FromConfig("length = 1\nmass = 1\ntime = 1s\n"),
+               std::runtime_error);
+  EXPECT_THROW(System::FromConfig("length = 1\nmass = 1\ntime = 1\nfoo = 2"),
+               std::runtime_error);
+  EXPECT_THROW(System::FromConfig("length 1\n"), std::runtime_error);
+}
+
+// Matching systems are routed to the compile-time preset, and others to the
+// runtime fallback.
+TEST(RuntimeDimensionsTest, DispatchOnPreset) {
+  const auto route = [](const auto& system) {
+    using System = std::remove_cvref_t<decltype(system)>;
+    if constexpr (std::is_same_v<System, EarthSystem>) return 1;
+    if constexpr (std::is_same_v<System, Dimensions::SIDimensions<>>) return 2;
+    return 0;
+  };
+  using Dimensions::DispatchOnPreset;
+  using Dimensions::SIDimensions;
+  const auto earth = Dimensions::RuntimeDimensions<>::FromConfig(EarthConfig);
+  const auto si = Dimensions::RuntimeDimensions<>({});
+  const auto other = Dimensions::RuntimeDimensions<>::FromMass(1.0, 2.0, 3.0);
+  EXPECT_EQ((DispatchOnPreset<SIDimensions<>, EarthSystem>(earth, route)), 1);
+  EXPECT_EQ((DispatchOnPreset<SIDimensions<>, EarthSystem>(si, route)), 2);
+  EXPECT_EQ((DispatchOnPreset<SIDimensions<>, EarthSystem>(other, route)), 0);
+
+  auto calls = 0;
+  DispatchOnPreset<EarthSystem>(earth, [&](const auto&) { ++calls; });
+  DispatchOnPreset<EarthSystem>(other, [&](const auto&) { ++calls; });
+  EXPECT_EQ(calls, 2);
+}
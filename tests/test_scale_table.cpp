@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+#include "Dimensions/ScaleTable.hpp"
+
+// A unit system whose base scales are only known at runtime.
+class RuntimeUnitSystem
+    : public Dimensions::Dimensions<RuntimeUnitSystem, double> {
+ public:
+  RuntimeUnitSystem(double length, double density, double time,
+                    double temperature)
+      : length_{length},
+        density_{density},
+        time_{time},
+        temperature_{temperature} {}
+
+  double LengthScale() const noexcept { return length_; }
+  double DensityScale() const noexcept { return density_; }
+  double TimeScale() const noexcept { return time_; }
+  double TemperatureScale() const noexcept { return temperature_; }
+
+ private:
+  double length_;
+  double density_;
+  double time_;
+  double temperature_;
+};
+
+// A compile-time system built on the mass-based helper.
+class MassUnitSystem
+    : public Dimensions::MechanicalMassDimensions<MassUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+// A mass-based system with scales that do not divide exactly, so that
+// recomputing the mass scale through the density can differ in the last bit.
+class AwkwardMassSystem
+    : public Dimensions::MechanicalMassDimensions<AwkwardMassSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 6.371e6; }
+  constexpr double MassScale() const noexcept { return 5.9722e24; }
+  constexpr double TimeScale() const noexcept { return 3.0e3; }
+};
+
+constexpr Dimensions::QuantityKind Kinds[] = {
+    Dimensions::QuantityKind::Length,
+    Dimensions::QuantityKind::Density,
+    Dimensions::QuantityKind::Time,
+    Dimensions::QuantityKind::Temperature,
+    Dimensions::QuantityKind::Mass,
+    Dimensions::QuantityKind::Velocity,
+    Dimensions::QuantityKind::Acceleration,
+    Dimensions::QuantityKind::Force,
+    Dimensions::QuantityKind::Traction,
+    Dimensions::QuantityKind::Moment,
+    Dimensions::QuantityKind::Potential,
+    Dimensions::QuantityKind::Energy,
+    Dimensions::QuantityKind::HeatFlux,
+    Dimensions::QuantityKind::ThermalConductivity,
+    Dimensions::QuantityKind::SpecificHeat,
+    Dimensions::QuantityKind::Entropy};
+
+class ScaleTableTest : public ::testing::Test {
+ protected:
+  RuntimeUnitSystem unit_system{6.371e6, 5.514e3, 3600.0, 273.15};
+};
+
+// The table must be a trivially copyable, cache-line aligned aggregate.
+TEST_F(ScaleTableTest, TableLayout) {
+  using Table = Dimensions::ScaleTable<double>;
+  EXPECT_TRUE(std::is_trivially_copyable_v<Table>);
+  EXPECT_EQ(alignof(Table), Dimensions::ScaleTableAlignment);
+}
+
+// Every cached value must agree with the value from the source system.
+TEST_F(ScaleTableTest, CachedValuesMatchSource) {
+  const auto cached = Dimensions::CachedDimensions(unit_system);
+  EXPECT_EQ(cached.LengthScale(), unit_system.LengthScale());
+  EXPECT_EQ(cached.DensityScale(), unit_system.DensityScale());
+  EXPECT_EQ(cached.TimeScale(), unit_system.TimeScale());
+  EXPECT_EQ(cached.TemperatureScale(), unit_system.TemperatureScale());
+  EXPECT_EQ(cached.MassScale(), unit_system.MassScale());
+  EXPECT_EQ(cached.VelocityScale(), unit_system.VelocityScale());
+  EXPECT_EQ(cached.AccelerationScale(), unit_system.AccelerationScale());
+  EXPECT_EQ(cached.ForceScale(), unit_system.ForceScale());
+  EXPECT_EQ(cached.TractionScale(), unit_system.TractionScale());
+  EXPECT_EQ(cached.MomentScale(), unit_system.MomentScale());
+  EXPECT_EQ(cached.PotentialScale(), unit_system.PotentialScale());
+  EXPECT_EQ(cached.EnergyScale(), unit_system.EnergyScale());
+  EXPECT_EQ(cached.HeatFluxScale(), unit_system.HeatFluxScale());
+  EXPECT_EQ(cached.ThermalConductivityScale(),
+            unit_system.ThermalConductivityScale());
+  EXPECT_EQ(cached.SpecificHeatScale(), unit_system.SpecificHeatScale());
+  EXPECT_EQ(cached.EntropyScale(), unit_system.EntropyScale());
+  EXPECT_EQ(cached.GravitationalConstant(),
+            unit_system.GravitationalConstant());
+  EXPECT_EQ(cached.BoltzmannConstant(), unit_system.BoltzmannConstant());
+}
+
+// The typed, runtime and named accessors of a cached system all return the
+// value held in the table.
+TEST_F(ScaleTableTest, TypedScalesMatchTable) {
+  const auto source = AwkwardMassSystem{};
+  const auto cached = Dimensions::CachedDimensions(source);
+  EXPECT_EQ(cached.Scale<Dimensions::Mass>(), source.MassScale());
+  EXPECT_EQ((cached.Scale<0, 1, 0, 0>()), cached.MassScale());
+  for (const auto kind : Kinds) {
+    Dimensions::VisitDimension(kind, [&]<typename Dim>(Dim) {
+      const auto expected = Dimensions::TableScale(cached.Table(), kind);
+      EXPECT_EQ(cached.Scale<Dim>(), expected);
+      EXPECT_EQ(cached.Scale(kind), expected);
+    });
+  }
+}
+
+// The typed and runtime reciprocals of a cached system both return the
+// reciprocal held in the table.
+TEST_F(ScaleTableTest, TypedInverseScalesMatchTable) {
+  const auto cached = Dimensions::CachedDimensions(AwkwardMassSystem{});
+  for (const auto kind : Kinds) {
+    Dimensions::VisitDimension(kind, [&]<typename Dim>(Dim) {
+      const auto expected = Dimensions::TableInverseScale(cached.Table(), kind);
+      EXPECT_EQ(cached.InverseScale<Dim>(), expected);
+      EXPECT_EQ((cached.InverseScale<Dim::Length, Dim::Mass, Dim::Time,
+                                     Dim::Temperature>()),
+                expected);
+      EXPECT_EQ(cached.Scale<Dimensions::DimensionInverse<Dim>>(), expected);
+      EXPECT_EQ(cached.InverseScale(kind), expected);
+    });
+  }
+}
+
+// Scales redefined by the helper classes must be picked up by the table.
+TEST_F(ScaleTableTest, TableUsesHelperScales) {
+  constexpr auto table = Dimensions::MakeScaleTable(MassUnitSystem{});
+  EXPECT_EQ(table.massScale, 3.0);
+  EXPECT_DOUBLE_EQ(table.densityScale, 0.375);
+  EXPECT_EQ(table.temperatureScale, 1.0);
+}
+
+// The cached reciprocals must agree with the direct reciprocal scales.
+TEST_F(ScaleTableTest, CachedInverseScales) {
+  using Dimensions::QuantityKind;
+  const auto cached = Dimensions::CachedDimensions(unit_system);
+  for (auto kind :
+       {QuantityKind::Length, QuantityKind::Velocity, QuantityKind::Traction,
+        QuantityKind::Energy, QuantityKind::HeatFlux,
+        QuantityKind::ThermalConductivity, QuantityKind::SpecificHeat,
+        QuantityKind::Entropy}) {
+    EXPECT_EQ(cached.InverseScale(kind), unit_system.InverseScale(kind));
+    EXPECT_DOUBLE_EQ(cached.InverseScale(kind) * cached.Scale(kind), 1.0);
+  }
+}
+
+namespace {
+
+// A default-constructible system with one accessor that is not constexpr.
+class PartlyRuntimeSystem
+    : public Dimensions::MechanicalMassDimensions<PartlyRuntimeSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+// A scaling kernel whose factor is a non-type template parameter.
+template <double Factor>
+constexpr double ScaleBy(double value) {
+  return value * Factor;
+}
+
+}  // namespace
+
+// Systems with constexpr scales are detected as compile-time systems, and
+// their tables can be used in constant expressions.
+TEST_F(ScaleTableTest, CompileTimeSystems) {
+  static_assert(Dimensions::CompileTimeSystem<MassUnitSystem>);
+  static_assert(!Dimensions::CompileTimeSystem<RuntimeUnitSystem>);
+  static_assert(!Dimensions::CompileTimeSystem<PartlyRuntimeSystem>);
+
+  constexpr auto& table = Dimensions::StaticScaleTable<MassUnitSystem>;
+  static_assert(table.massScale == 3.0);
+  static_assert(ScaleBy<table.velocityScale>(4.0) == 2.0);
+  EXPECT_EQ(Dimensions::CompileTimeScaleTable<MassUnitSystem>().energyScale,
+            MassUnitSystem{}.EnergyScale());
+}
+
+// Tables can be passed by value to kernels, and the free lookups used in
+// device code agree with the system.
+TEST_F(ScaleTableTest, TableLookupForKernels) {
+  using Dimensions::QuantityKind;
+  static_assert(std::is_trivially_copyable_v<Dimensions::ScaleTable<float>>);
+  static_assert(std::is_trivially_copyable_v<Dimensions::CachedDimensions<>>);
+  constexpr auto& table = Dimensions::StaticScaleTable<MassUnitSystem>;
+  static_assert(Dimensions::TableScale(table, QuantityKind::Force) ==
+                MassUnitSystem{}.ForceScale());
+  const auto system = MassUnitSystem{};
+  for (auto kind : {QuantityKind::Length, QuantityKind::Density,
+                    QuantityKind::Moment, QuantityKind::Energy,
+                    QuantityKind::HeatFlux, QuantityKind::Entropy}) {
+    EXPECT_DOUBLE_EQ(Dimensions::TableScale(table, kind), system.Scale(kind));
+    EXPECT_DOUBLE_EQ(Dimensions::TableInverseScale(table, kind),
+                     system.InverseScale(kind));
+  }
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "Dimensions/ScratchArena.hpp"
+
+class ArenaSystem : public Dimensions::Dimensions<ArenaSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 10.0; }
+  constexpr double DensityScale() const noexcept { return 2.0; }
+  constexpr double TimeScale() const noexcept { return 5.0; }
+  constexpr double TemperatureScale() const noexcept { return 1.0; }
+};
+
+TEST(ScratchArenaTest, BuffersAreAlignedAndDistinct) {
+  auto arena = Dimensions::ScratchArena();
+  const auto a = arena.Allocate<double>(3);
+  const auto b = arena.Allocate<float>(5);
+  EXPECT_EQ(a.size(), 3u);
+  EXPECT_EQ(b.size(), 5u);
+  for (const void* p : {static_cast<const void*>(a.data()),
+                        static_cast<const void*>(b.data())}) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) %
+                  Dimensions::ScratchAlignment,
+              0u);
+  }
+  EXPECT_GE(static_cast<const void*>(b.data()),
+            static_cast<const void*>(a.data() + a.size()));
+  EXPECT_TRUE(arena.Allocate<double>(0).empty());
+}
+
+TEST(ScratchArenaTest, SteadyStateStepsDoNotAllocate) {
+  const auto system = ArenaSystem();
+  const auto field = std::vector<double>(1000, 1.0);
+  auto arena = Dimensions::ScratchArena();
+
+  const auto step = [&] {
+    const auto v = Dimensions::Redimensionalise(
+        system, field, Dimensions::QuantityKind::Velocity, arena);
+    const auto s = Dimensions::Redimensionalise(
+        system, field, Dimensions::QuantityKind::Traction, arena);
+    const auto l = Dimensions::Nondimensionalise(
+        system, field, Dimensions::QuantityKind::Length, arena);
+    EXPECT_DOUBLE_EQ(v[0], system.VelocityScale());
+    EXPECT_DOUBLE_EQ(s[999], system.TractionScale());
+    EXPECT_DOUBLE_EQ(l[500], 1.0 / system.LengthScale());
+    arena.Reset();
+  };
+
+  // The first steps grow the arena and the next Reset coalesces it.
+  step();
+  step();
+  const auto allocations = arena.ChunkAllocations();
+  for (int i = 0; i < 10; ++i) step();
+  EXPECT_EQ(arena.ChunkAllocations(), allocations);
+  EXPECT_GE(arena.Capacity(), 3 * 1000 * sizeof(double));
+  EXPECT_EQ(arena.Used(), 0u);
+}
+
+TEST(ScratchArenaTest, ReservePreallocatesOneChunk) {
+  auto arena = Dimensions::ScratchArena();
+  arena.Reserve(1 << 16);
+  EXPECT_EQ(arena.ChunkAllocations(), 1u);
+  EXPECT_GE(arena.Capacity(), std::size_t{1} << 16);
+  static_cast<void>(arena.Allocate<double>(1000));
+  static_cast<void>(arena.Allocate<double>(1000));
+  EXPECT_EQ(arena.ChunkAllocations(), 1u);
+  EXPECT_GE(arena.Used(), 2000 * sizeof(double));
+}
+
+TEST(ScratchArenaTest, ServesPolymorphicContainers) {
+  auto arena = Dimensions::ScratchArena(1 << 12);
+  auto values = std::pmr::vector<double>(&arena);
+  for (int i = 0; i < 100; ++i) values.push_back(i);
+  EXPECT_EQ(values[99], 99.0);
+  EXPECT_GT(arena.Used(), 0u);
+}
+
+TEST(ScratchArenaTest, OversizedRequestsThrowWithoutAllocating) {
+  auto arena = Dimensions::ScratchArena();
+  constexpr auto max = std::numeric_limits<std::size_t>::max();
+  EXPECT_THROW(static_cast<void>(arena.Allocate<double>(max / 4)),
+               std::bad_alloc);
+  EXPECT_THROW(static_cast<void>(arena.Allocate<std::byte>(max - 1)),
+               std::bad_alloc);
+  EXPECT_EQ(arena.ChunkAllocations(), 0u);
+  EXPECT_EQ(arena.Capacity(), 0u);
+  // The arena remains usable.
+  EXPECT_EQ(arena.Allocate<double>(10).size(), 10u);
+}
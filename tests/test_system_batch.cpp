@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "Dimensions/RuntimeDimensions.hpp"
+#include "Dimensions/SystemBatch.hpp"
+
+template <typename Real>
+class SystemBatchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // An odd size checks the remainder of vectorised loops.
+    for (std::size_t i = 0; i < 101; ++i) {
+      const auto x = static_cast<Real>(i);
+      systems.push_back({.lengthScale = static_cast<Real>(6.371e6 + 1e4 * x),
+                         .densityScale = static_cast<Real>(5.5e3 - 10 * x),
+                         .timeScale = static_cast<Real>(3600) + x,
+                         .temperatureScale = static_cast<Real>(273) + x});
+    }
+  }
+
+  std::vector<Dimensions::SystemConstants<Real>> systems;
+};
+
+using RealTypes = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(SystemBatchTest, RealTypes);
+
+TYPED_TEST(SystemBatchTest, MatchesPerSystemEvaluation) {
+  using Real = TypeParam;
+  const auto batch = Dimensions::SystemBatch<Real>(this->systems);
+  ASSERT_EQ(batch.size(), this->systems.size());
+  auto energy = std::vector<Real>(batch.size());
+  auto inverseForce = std::vector<Real>(batch.size());
+  auto g = std::vector<Real>(batch.size());
+  auto kB = std::vector<Real>(batch.size());
+  batch.Scales(Dimensions::QuantityKind::Energy, energy);
+  batch.InverseScales(Dimensions::QuantityKind::Force, inverseForce);
+  batch.GravitationalConstants(g);
+  batch.BoltzmannConstants(kB);
+  for (std::size_t i = 0; i < batch.size(); ++i) {
+    const auto system = Dimensions::RuntimeDimensions<Real>(this->systems[i]);
+    EXPECT_EQ(batch[i], this->systems[i]);
+    EXPECT_EQ(energy[i], system.EnergyScale());
+    EXPECT_EQ(inverseForce[i],
+              system.template InverseScale<Dimensions::Force>());
+    EXPECT_EQ(g[i], system.GravitationalConstant());
+    EXPECT_EQ(kB[i], system.BoltzmannConstant());
+  }
+}
+
+TYPED_TEST(SystemBatchTest, BuildsScaleTables) {
+  using Real = TypeParam;
+  auto batch = Dimensions::SystemBatch<Real>();
+  for (const auto& system : this->systems) batch.Add(system);
+  const auto tables = batch.ScaleTables();
+  ASSERT_EQ(tables.size(), this->systems.size());
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    const auto expected = Dimensions::MakeScaleTable(
+        Dimensions::RuntimeDimensions<Real>(this->systems[i]));
+    EXPECT_EQ(tables[i].lengthScale, expected.lengthScale);
+    EXPECT_EQ(tables[i].massScale, expected.massScale);
+    EXPECT_EQ(tables[i].potentialScale, expected.potentialScale);
+    EXPECT_EQ(tables[i].inverseEnergyScale, expected.inverseEnergyScale);
+    EXPECT_EQ(tables[i].thermalConductivityScale,
+              expected.thermalConductivityScale);
+    EXPECT_EQ(tables[i].inverseEntropyScale, expected.inverseEntropyScale);
+    EXPECT_EQ(tables[i].inverseTemperatureScale,
+              expected.inverseTemperatureScale);
+    EXPECT_EQ(tables[i].gravitationalConstant,
+              expected.gravitationalConstant);
+    EXPECT_EQ(tables[i].boltzmannConstant, expected.boltzmannConstant);
+  }
+}
+
+TEST(SystemBatchArraysTest, ConstructsFromBaseScaleArrays) {
+  const auto batch = Dimensions::SystemBatch<double>(
+      {1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}, {1.0, 1.0});
+  auto velocity = std::vector<double>(2);
+  batch.Scales<Dimensions::Velocity>(velocity);
+  EXPECT_DOUBLE_EQ(velocity[0], 1.0 / 5.0);
+  EXPECT_DOUBLE_EQ(velocity[1], 2.0 / 6.0);
+  EXPECT_EQ(batch.DensityScales()[1], 4.0);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <vector>
+
+#include "Dimensions/Views.hpp"
+
+namespace {
+
+class ViewUnitSystem
+    : public Dimensions::MechanicalMassDimensions<ViewUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 2.0; }
+  constexpr double MassScale() const noexcept { return 3.0; }
+  constexpr double TimeScale() const noexcept { return 4.0; }
+};
+
+class OtherUnitSystem
+    : public Dimensions::MechanicalMassDimensions<OtherUnitSystem, double> {
+ public:
+  constexpr double LengthScale() const noexcept { return 5.0; }
+  constexpr double MassScale() const noexcept { return 7.0; }
+  constexpr double TimeScale() const noexcept { return 0.5; }
+};
+
+}  // namespace
+
+// The views scale lazily while keeping random access and the size.
+TEST(ViewsTest, LazyRedimensionalise) {
+  using Dimensions::QuantityKind;
+  const auto system = ViewUnitSystem{};
+  const auto field = std::vector<double>{1.0, 2.0, 3.0, 4.0};
+  auto view = field | Dimensions::Views::Redimensionalise(
+                          system, QuantityKind::Traction);
+  static_assert(std::ranges::random_access_range<decltype(view)>);
+  static_assert(std::ranges::sized_range<decltype(view)>);
+  EXPECT_EQ(view.size(), field.size());
+  EXPECT_DOUBLE_EQ(view[2], 3.0 * system.TractionScale());
+
+  const auto sum = std::accumulate(view.begin(), view.end(), 0.0);
+  EXPECT_DOUBLE_EQ(sum, 10.0 * system.TractionScale());
+}
+
+// Views compose with one another and with the fused conversion factor.
+TEST(ViewsTest, ComposeWithConversion) {
+  const auto system = ViewUnitSystem{};
+  const auto other = OtherUnitSystem{};
+  const auto field = std::vector<double>{1.0, 2.0, 3.0};
+  auto converted =
+      field | Dimensions::Views::Convert<Dimensions::Velocity>(system, other);
+  auto restored = converted |
+                  Dimensions::Views::Redimensionalise<Dimensions::Velocity>(
+                      other) |
+                  Dimensions::Views::Nondimensionalise<Dimensions::Velocity>(
+                      system);
+  for (std::size_t i = 0; i < field.size(); ++i) {
+    EXPECT_DOUBLE_EQ(converted[i], field[i] * system.VelocityScale() /
+                                       other.VelocityScale());
+    EXPECT_DOUBLE_EQ(restored[i], field[i]);
+  }
+}